@@ -0,0 +1,62 @@
+#include "faker-cxx/Datatype.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace faker;
+
+namespace
+{
+void boolean(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(datatype::boolean());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void booleanWithProbabilityInLoop(benchmark::State& state)
+{
+    std::vector<std::uint64_t> mask(static_cast<std::size_t>(state.range(0)) / 64);
+
+    for (auto _ : state)
+    {
+        for (auto& word : mask)
+        {
+            word = 0;
+
+            for (unsigned bit = 0; bit < 64; bit++)
+            {
+                word |= static_cast<std::uint64_t>(datatype::boolean(0.1)) << bit;
+            }
+        }
+
+        benchmark::DoNotOptimize(mask.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void booleans(benchmark::State& state, double probability)
+{
+    std::vector<std::uint64_t> mask(static_cast<std::size_t>(state.range(0)) / 64);
+
+    for (auto _ : state)
+    {
+        datatype::booleans(mask, probability);
+
+        benchmark::DoNotOptimize(mask.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}
+
+BENCHMARK(boolean);
+BENCHMARK(booleanWithProbabilityInLoop)->Arg(1 << 20);
+BENCHMARK_CAPTURE(booleans, half, 0.5)->Arg(1 << 20);
+BENCHMARK_CAPTURE(booleans, tenth, 0.1)->Arg(1 << 20);
@@ -0,0 +1,260 @@
+#include "faker-cxx/Helper.h"
+#include "faker-cxx/Random.h"
+#include "faker-cxx/Sampling.h"
+#include "faker-cxx/System.h"
+#include "faker-cxx/Unique.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "common/AlgoHelper.h"
+
+using namespace faker;
+
+namespace
+{
+void replaceSymbolWithNumber(benchmark::State& state)
+{
+    const std::string format{"!##-###-####"};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(helper::replaceSymbolWithNumber(format));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+std::vector<helper::WeightedElement<std::string_view>> weightedElements(std::size_t count)
+{
+    std::vector<helper::WeightedElement<std::string_view>> elements;
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        elements.push_back({static_cast<unsigned>(i % 7 + 1), "value"});
+    }
+
+    return elements;
+}
+
+void digitTemplateBulk(benchmark::State& state)
+{
+    const helper::DigitTemplate phone{"!##-###-####"};
+
+    std::string out(phone.size() * 1024, ' ');
+
+    for (auto _ : state)
+    {
+        phone.render(out);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+void regexpStyleStringParse(benchmark::State& state)
+{
+    const std::string format{"64[4-9]#-62##-[0-9A-F]{4}-####-#{2,4}L"};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(helper::regexpStyleStringParse(format));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void replaceCreditCardSymbols(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(helper::replaceCreditCardSymbols("64[4-9]#-62##-####-####-###L"));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void unique(benchmark::State& state)
+{
+    helper::UniqueOptions options;
+    options.exactLimit = static_cast<std::size_t>(state.range(0));
+
+    auto numbers = helper::unique([] { return random::engine()(); }, options);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(numbers());
+    }
+
+    state.counters["memoryBytes"] = static_cast<double>(numbers.stats().memoryBytes);
+    state.SetItemsProcessed(state.iterations());
+}
+
+void networkInterface(benchmark::State& state)
+{
+    system::NetworkInterfaceOptions options;
+    options.interfaceSchema = "pci";
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(system::networkInterface(options));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void weightedArrayElement(benchmark::State& state)
+{
+    const auto elements = weightedElements(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(helper::weightedArrayElement(elements));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void weightedSampler(benchmark::State& state)
+{
+    const helper::WeightedSampler sampler{weightedElements(static_cast<std::size_t>(state.range(0)))};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sampler());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void weightedSamplerBulk(benchmark::State& state)
+{
+    const helper::WeightedSampler sampler{weightedElements(static_cast<std::size_t>(state.range(0)))};
+
+    std::vector<std::string_view> values(1024);
+
+    for (auto _ : state)
+    {
+        sampler(std::span<std::string_view>{values});
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(values.size()));
+}
+
+void distinctIndices(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(helper::distinctIndices(1024, count));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Algorithm R, one draw per element, as a baseline for the skipping samplers.
+void reservoirSampleWithOneDrawPerElement(benchmark::State& state)
+{
+    const std::vector<int> stream(1'000'000, 7);
+    const auto sampleSize = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::vector<int> sample(stream.begin(), stream.begin() + state.range(0));
+
+        for (std::size_t i = sampleSize; i < stream.size(); i++)
+        {
+            const auto index = random::UniformBound::draw(random::engine(), i);
+
+            if (index < sampleSize)
+            {
+                sample[index] = stream[i];
+            }
+        }
+
+        benchmark::DoNotOptimize(sample);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1'000'000);
+}
+
+void reservoirSample(benchmark::State& state)
+{
+    const std::vector<int> stream(1'000'000, 7);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(helper::reservoirSample(stream, static_cast<std::size_t>(state.range(0))));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1'000'000);
+}
+
+void weightedReservoirSample(benchmark::State& state)
+{
+    const std::vector<int> stream(1'000'000, 7);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(helper::weightedReservoirSample(stream, static_cast<std::size_t>(state.range(0)),
+                                                                 [](int value) { return value; }));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1'000'000);
+}
+
+void shuffleWithStdShuffle(benchmark::State& state)
+{
+    std::vector<std::uint32_t> values(static_cast<std::size_t>(state.range(0)));
+
+    std::iota(values.begin(), values.end(), 0u);
+
+    for (auto _ : state)
+    {
+        std::shuffle(values.begin(), values.end(), random::engine());
+
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void shuffle(benchmark::State& state)
+{
+    std::vector<std::uint32_t> values(static_cast<std::size_t>(state.range(0)));
+
+    std::iota(values.begin(), values.end(), 0u);
+
+    for (auto _ : state)
+    {
+        helper::shuffle(values);
+
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}
+
+BENCHMARK(replaceSymbolWithNumber);
+BENCHMARK(digitTemplateBulk);
+BENCHMARK(regexpStyleStringParse);
+BENCHMARK(replaceCreditCardSymbols);
+BENCHMARK(unique)->Arg(1 << 30)->Arg(0);
+BENCHMARK(networkInterface);
+BENCHMARK(weightedArrayElement)->Arg(4)->Arg(64)->Arg(1024);
+BENCHMARK(weightedSampler)->Arg(4)->Arg(64)->Arg(1024);
+BENCHMARK(weightedSamplerBulk)->Arg(64);
+BENCHMARK(distinctIndices)->Arg(4)->Arg(64)->Arg(1024);
+BENCHMARK(reservoirSampleWithOneDrawPerElement)->Arg(100);
+BENCHMARK(reservoirSample)->Arg(100);
+BENCHMARK(weightedReservoirSample)->Arg(100);
+BENCHMARK(shuffleWithStdShuffle)->Arg(1 << 16)->Arg(1 << 24)->Unit(benchmark::kMillisecond);
+BENCHMARK(shuffle)->Arg(1 << 16)->Arg(1 << 24)->Unit(benchmark::kMillisecond);
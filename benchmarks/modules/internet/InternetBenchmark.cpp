@@ -0,0 +1,22 @@
+#include "faker-cxx/Internet.h"
+
+#include "benchmark/benchmark.h"
+
+using namespace faker;
+
+namespace
+{
+void password(benchmark::State& state)
+{
+    const auto length = static_cast<int>(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(internet::password(length));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+}
+
+BENCHMARK(password)->Arg(16)->Arg(1 << 10);
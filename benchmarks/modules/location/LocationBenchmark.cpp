@@ -0,0 +1,58 @@
+#include "faker-cxx/Location.h"
+
+#include "benchmark/benchmark.h"
+#include "faker-cxx/ValuePool.h"
+
+using namespace faker;
+
+namespace
+{
+void city(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(location::city());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void streetAddress(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(location::streetAddress());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void streetAddressPoolFill(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(helper::ValuePool{100'000, [] { return location::streetAddress(); },
+                                                   {.threadCount = static_cast<unsigned>(state.range(0))}});
+    }
+
+    state.SetItemsProcessed(state.iterations() * 100'000);
+}
+
+void streetAddressPoolDraw(benchmark::State& state)
+{
+    helper::ValuePool pool{100'000, [] { return location::streetAddress(); },
+                           {.distribution = static_cast<helper::PoolDistribution>(state.range(0))}};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(pool());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+}
+
+BENCHMARK(city);
+BENCHMARK(streetAddress);
+BENCHMARK(streetAddressPoolFill)->Arg(1)->Arg(0)->Unit(benchmark::kMillisecond);
+BENCHMARK(streetAddressPoolDraw)->Arg(0)->Arg(1);
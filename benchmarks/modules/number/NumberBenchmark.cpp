@@ -0,0 +1,243 @@
+#include "faker-cxx/Number.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "faker-cxx/Random.h"
+
+using namespace faker;
+
+namespace
+{
+// Reproduces the engine number::integer drew from before the engine registry was introduced.
+void integerWithMt19937(benchmark::State& state)
+{
+    static std::mt19937 pseudoRandomGenerator{std::random_device{}()};
+
+    for (auto _ : state)
+    {
+        std::uniform_int_distribution<int> distribution(0, 1000);
+
+        benchmark::DoNotOptimize(distribution(pseudoRandomGenerator));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void integerWithEngine(benchmark::State& state, random::EngineType type)
+{
+    random::setEngineType(type);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(number::integer<int>(0, 1000));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void integerInLoop(benchmark::State& state)
+{
+    std::vector<int> values(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (auto& value : values)
+        {
+            value = number::integer<int>(0, 1000);
+        }
+
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void integersBulk(benchmark::State& state)
+{
+    std::vector<int> values(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        number::integers<int>(values, 0, 1000);
+
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Reproduces number::decimal before it built doubles directly from the engine's mantissa bits.
+void decimalWithUniformRealDistribution(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::uniform_real_distribution<double> distribution(-180., 180.);
+
+        benchmark::DoNotOptimize(distribution(random::engine()));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void decimal(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(number::decimal<double>(-180., 180.));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void decimalsBulk(benchmark::State& state)
+{
+    std::vector<double> values(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        number::decimals<double>(values, -180., 180.);
+
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Reproduces drawing from a distribution object built per call, as callers did before number::normal existed.
+void normalWithNormalDistribution(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::normal_distribution<double> distribution(0., 1.);
+
+        benchmark::DoNotOptimize(distribution(random::engine()));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void normal(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(number::normal());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void exponentialWithExponentialDistribution(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::exponential_distribution<double> distribution(1.);
+
+        benchmark::DoNotOptimize(distribution(random::engine()));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void exponential(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(number::exponential());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void poissonWithPoissonDistribution(benchmark::State& state)
+{
+    const auto mean = static_cast<double>(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::poisson_distribution<std::uint64_t> distribution(mean);
+
+        benchmark::DoNotOptimize(distribution(random::engine()));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void poisson(benchmark::State& state)
+{
+    const auto mean = static_cast<double>(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(number::poisson(mean));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void normalsBulk(benchmark::State& state)
+{
+    std::vector<double> values(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        number::normals(values);
+
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void zipf(benchmark::State& state)
+{
+    const number::ZipfSampler sampler{static_cast<std::uint64_t>(state.range(0)), 1.1};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sampler());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void permutation(benchmark::State& state)
+{
+    const number::Permutation permutation{0, static_cast<std::uint64_t>(state.range(0)) - 1, 42};
+
+    std::uint64_t index = 0;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(permutation(index));
+
+        if (++index > permutation.max())
+        {
+            index = 0;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+}
+
+BENCHMARK(integerWithMt19937);
+BENCHMARK_CAPTURE(integerWithEngine, xoshiro256StarStar, random::EngineType::Xoshiro256StarStar);
+BENCHMARK_CAPTURE(integerWithEngine, pcg64, random::EngineType::Pcg64);
+BENCHMARK_CAPTURE(integerWithEngine, wyrand, random::EngineType::Wyrand);
+BENCHMARK(integerInLoop)->Arg(1 << 16);
+BENCHMARK(integersBulk)->Arg(1 << 16);
+BENCHMARK(decimalWithUniformRealDistribution);
+BENCHMARK(decimal);
+BENCHMARK(decimalsBulk)->Arg(1 << 16);
+BENCHMARK(normalWithNormalDistribution);
+BENCHMARK(normal);
+BENCHMARK(normalsBulk)->Arg(1 << 16);
+BENCHMARK(exponentialWithExponentialDistribution);
+BENCHMARK(exponential);
+BENCHMARK(poissonWithPoissonDistribution)->Arg(4)->Arg(100);
+BENCHMARK(poisson)->Arg(4)->Arg(100);
+BENCHMARK(zipf)->Arg(100)->Arg(1 << 30);
+BENCHMARK(permutation)->Arg(1000)->Arg(1'000'000'000'000);
@@ -0,0 +1,42 @@
+#include "faker-cxx/Person.h"
+
+#include "benchmark/benchmark.h"
+
+using namespace faker;
+
+namespace
+{
+void fullName(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(person::fullName());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void bio(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(person::bio());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void ssn(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(person::ssn(person::SsnCountry::Poland));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+}
+
+BENCHMARK(fullName);
+BENCHMARK(bio);
+BENCHMARK(ssn);
@@ -0,0 +1,61 @@
+#include "faker-cxx/Random.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace faker;
+
+namespace
+{
+void fillWithEngine(benchmark::State& state)
+{
+    std::vector<std::uint64_t> words(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        auto& generator = random::engine();
+
+        for (auto& word : words)
+        {
+            word = generator();
+        }
+
+        benchmark::DoNotOptimize(words.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(std::uint64_t)));
+}
+
+void fillWithInstructionSet(benchmark::State& state, random::InstructionSet instructionSet)
+{
+    if (!random::isSupported(instructionSet))
+    {
+        state.SkipWithError("Instruction set is not supported by this CPU.");
+        return;
+    }
+
+    const auto previousInstructionSet = random::instructionSet();
+
+    random::setInstructionSet(instructionSet);
+
+    std::vector<std::uint64_t> words(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        random::fill(words);
+
+        benchmark::DoNotOptimize(words.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(std::uint64_t)));
+
+    random::setInstructionSet(previousInstructionSet);
+}
+}
+
+BENCHMARK(fillWithEngine)->Arg(1 << 16);
+BENCHMARK_CAPTURE(fillWithInstructionSet, scalar, random::InstructionSet::Scalar)->Arg(1 << 16);
+BENCHMARK_CAPTURE(fillWithInstructionSet, avx2, random::InstructionSet::Avx2)->Arg(1 << 16);
+BENCHMARK_CAPTURE(fillWithInstructionSet, avx512, random::InstructionSet::Avx512)->Arg(1 << 16);
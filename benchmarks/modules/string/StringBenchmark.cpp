@@ -0,0 +1,103 @@
+#include "faker-cxx/String.h"
+
+#include <string>
+#include <utility>
+
+#include "benchmark/benchmark.h"
+
+using namespace faker;
+
+namespace
+{
+void numeric(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(string::numeric(16, false));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void numericAppend(benchmark::State& state)
+{
+    std::string buffer;
+
+    for (auto _ : state)
+    {
+        buffer.clear();
+
+        string::numeric(buffer, 16, false);
+
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void hexadecimal(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(string::hexadecimal(32));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void binary(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(string::binary(64));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void alphanumeric(benchmark::State& state)
+{
+    const auto length = static_cast<unsigned>(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(string::alphanumeric(length, string::StringCasing::Mixed, "0Oo"));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void hexadecimalLong(benchmark::State& state)
+{
+    const auto length = static_cast<unsigned>(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(string::hexadecimal(length));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void alphanumericWithGuarantee(benchmark::State& state)
+{
+    const auto length = static_cast<unsigned>(state.range(0));
+
+    for (auto _ : state)
+    {
+        string::GuaranteeMap guarantee{{'a', {1, length / 4}}, {'7', {2, length}}, {'Z', {0, 1}}};
+
+        benchmark::DoNotOptimize(string::alphanumeric(std::move(guarantee), length));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+}
+
+BENCHMARK(numeric);
+BENCHMARK(numericAppend);
+BENCHMARK(hexadecimal);
+BENCHMARK(binary);
+BENCHMARK(alphanumeric)->Arg(16)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(hexadecimalLong)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(alphanumericWithGuarantee)->Arg(16)->Arg(1 << 10)->Arg(1 << 20);
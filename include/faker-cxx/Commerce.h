@@ -61,6 +61,21 @@ FAKER_CXX_EXPORT std::string_view productMaterial();
  */
 FAKER_CXX_EXPORT std::string_view productName();
 
+/**
+ * @brief Returns a random product short name, with some products far more frequent than others.
+ *
+ * @param skew The Zipf exponent, see `helper::zipfArrayElement`. 0 gives the same distribution as `productName()`.
+ *
+ * @throws std::invalid_argument if skew is negative.
+ *
+ * @returns Product short name.
+ *
+ * @code
+ * faker::commerce::productName(1.1) // "Chair"
+ * @endcode
+ */
+FAKER_CXX_EXPORT std::string_view productName(double skew);
+
 /**
  * @brief Returns a random product full name.
  *
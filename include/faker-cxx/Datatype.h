@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
+
 #include "faker-cxx/Export.h"
 
 namespace faker::datatype
@@ -21,7 +24,7 @@ FAKER_CXX_EXPORT bool boolean();
  * A probability of `0.75` results in `true` being returned `75%` of the calls; likewise `0.3` => `30%`.
  * If the probability is `<= 0.0`, it will always return `false`.
  * If the probability is `>= 1.0`, it will always return `true`.
- * The probability is limited to two decimal places.
+ * A NaN probability is treated as `0.5`.
  *
  * @param probability The probability (`[0.00, 1.00]`) of returning `true`.
  *
@@ -34,4 +37,23 @@ FAKER_CXX_EXPORT bool boolean();
  * @endcode
  */
 FAKER_CXX_EXPORT bool boolean(double probability);
+
+/**
+ * @brief Fills the given span with packed random booleans, for example nullability masks.
+ *
+ * Every bit is set with the given probability, rounded to a multiple of `2^-32`. A probability of `0.5` costs one
+ * random word per 64 bits, other probabilities at most 32 words per 64 bits and fewer when the probability has a
+ * short binary expansion, for example `0.25` takes two.
+ * If the probability is `<= 0.0`, all bits are cleared, if it is `>= 1.0`, all bits are set.
+ * A NaN probability is treated as `0.5`.
+ *
+ * @param mask The span of 64-bit words to fill, bit `i` of word `j` is boolean number `64 * j + i`.
+ * @param probability The probability (`[0.00, 1.00]`) of a bit being set.
+ *
+ * @code
+ * std::vector<std::uint64_t> nullMask((rowCount + 63) / 64);
+ * faker::datatype::booleans(nullMask, 0.1) // about 10% of the bits are set
+ * @endcode
+ */
+FAKER_CXX_EXPORT void booleans(std::span<std::uint64_t> mask, double probability = 0.5);
 }
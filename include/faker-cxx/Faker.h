@@ -28,11 +28,16 @@
 #include "faker-cxx/Person.h"
 #include "faker-cxx/Phone.h"
 #include "faker-cxx/Plant.h"
+#include "faker-cxx/Random.h"
 #include "faker-cxx/RandomGenerator.h"
+#include "faker-cxx/Sampling.h"
 #include "faker-cxx/Science.h"
 #include "faker-cxx/Sport.h"
 #include "faker-cxx/String.h"
+#include "faker-cxx/StringParts.h"
 #include "faker-cxx/System.h"
+#include "faker-cxx/Unique.h"
+#include "faker-cxx/ValuePool.h"
 #include "faker-cxx/Vehicle.h"
 #include "faker-cxx/Version.h"
 #include "faker-cxx/VideoGame.h"
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -180,6 +181,27 @@ namespace faker::finance
      */
     FAKER_CXX_EXPORT std::string accountNumber(unsigned length = 8);
 
+    /**
+     * Generates the account number at index in a keyed permutation of all account numbers of the given length.
+     *
+     * Distinct indices give distinct account numbers for the same key, so walking the indices issues unique account
+     * numbers without remembering the ones already issued.
+     *
+     * @param length The length of the account number, at most `19`.
+     * @param index The position in the permutation, smaller than `10^length`.
+     * @param key Selects the permutation.
+     *
+     * @throws std::invalid_argument if length is 0 or greater than 19, or if index is not smaller than `10^length`.
+     *
+     * @returns Account number.
+     *
+     * @code
+     * faker::finance::accountNumber(10, 0, 42) // "3512709986"
+     * faker::finance::accountNumber(10, 1, 42) // "8788878352"
+     * @endcode
+     */
+    FAKER_CXX_EXPORT std::string accountNumber(unsigned length, std::uint64_t index, std::uint64_t key);
+
     /**
      * Generates a random PIN number.
      *
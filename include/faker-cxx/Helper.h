@@ -1,11 +1,23 @@
 #pragma once
 
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <numeric>
+#include <random>
 #include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "faker-cxx/Export.h"
 #include "Number.h"
+#include "Random.h"
 
 namespace faker::helper
 {
@@ -61,7 +73,7 @@ auto arrayElement(It start, It end) -> decltype(*::std::declval<It>())
 
     const std::integral auto index = number::integer<size_t>(size - 1);
 
-    return start[index];
+    return start[static_cast<std::ptrdiff_t>(index)];
 }
 
 /**
@@ -117,19 +129,85 @@ T arrayElement(const std::initializer_list<T>& data)
 }
 
 /**
- * @brief Get a random element by weight from a vector.
+ * @brief Get a random element from a range, with earlier elements more likely than later ones.
  *
- * @tparam T an element type of the weighted element.
+ * The element at index i is drawn with probability proportional to 1 / (i + 1)^skew, see `number::ZipfSampler`.
+ * A skew of 0 gives the same distribution as `arrayElement`, common values are between 0.8 and 1.2.
  *
- * @param data vector of weighted elements.
+ * @tparam It a random access iterator.
  *
- * @return T a weighted element value from the vector.
+ * @param start The beginning of the range.
+ * @param end The end of the range.
+ * @param skew The Zipf exponent.
+ *
+ * @throws std::invalid_argument if the range is empty or skew is negative.
+ *
+ * @return A reference to the drawn element.
  *
  * @code
- * faker::helper::weightedArrayElement<std::string>(std::vector<helper::WeightedElement<std::string>>{{1, "value1"},
- * {10, "value2"}}) // "hello2"
+ * const std::vector<std::string> domains{"com", "org", "net", "io"};
+ * faker::helper::zipfArrayElement(domains.begin(), domains.end(), 1.2) // "com"
+ * @endcode
+ */
+template <typename It>
+auto zipfArrayElement(It start, It end, double skew) -> decltype(*::std::declval<It>())
+{
+    auto size = static_cast<size_t>(end - start);
+
+    if (size == 0)
+    {
+        throw std::invalid_argument{"Range [start,end) is empty."};
+    }
+
+    const auto rank = number::zipf(size, skew);
+
+    return start[static_cast<std::ptrdiff_t>(rank - 1)];
+}
+
+/**
+ * @brief Get a random element from a span, with earlier elements more likely than later ones.
+ *
+ * @tparam T an element type of the span.
+ *
+ * @param data The span.
+ * @param skew The Zipf exponent, see `zipfArrayElement(It, It, double)`.
+ *
+ * @throws std::invalid_argument if data is empty or skew is negative.
+ *
+ * @return T a random element from the span.
+ *
+ * @code
+ * faker::helper::zipfArrayElement<char>(std::string{"abcd"}, 1.) // "a"
+ * @endcode
+ */
+template <class T>
+T zipfArrayElement(std::span<const T> data, double skew)
+{
+    return zipfArrayElement(data.begin(), data.end(), skew);
+}
+
+/**
+ * @brief Get a random element from an array, with earlier elements more likely than later ones.
+ *
+ * @tparam T an element type of the array.
+ * @tparam N a size of the array.
+ *
+ * @param data The array.
+ * @param skew The Zipf exponent, see `zipfArrayElement(It, It, double)`.
+ *
+ * @throws std::invalid_argument if data is empty or skew is negative.
+ *
+ * @return T a random element from the array.
+ *
+ * @code
+ * faker::helper::zipfArrayElement(std::to_array<std::string_view>({"com", "org", "net"}), 1.2) // "com"
  * @endcode
  */
+template <typename T, std::size_t N>
+T zipfArrayElement(const std::array<T, N>& data, double skew)
+{
+    return zipfArrayElement(data.begin(), data.end(), skew);
+}
 
 template <class T>
 struct WeightedElement
@@ -138,6 +216,221 @@ struct WeightedElement
     T value;
 };
 
+/**
+ * @brief Draws values by weight in constant time.
+ *
+ * Builds Vose's alias table once: every element owns one bucket holding an acceptance threshold and an alias, a draw
+ * picks a bucket uniformly and returns either its own element or the alias. The table is computed with integers, so the
+ * probability of each element is exactly its weight divided by the sum of weights.
+ *
+ * With a fixed extent the table is stored in arrays and the sampler can be built at compile time.
+ *
+ * @tparam T an element type of the weighted elements.
+ * @tparam N the number of elements, or std::dynamic_extent to size the table at runtime.
+ *
+ * @code
+ * const faker::helper::WeightedSampler sampler{std::vector<faker::helper::WeightedElement<std::string>>{{1, "value1"},
+ * {10, "value2"}}};
+ * sampler() // "value2"
+ *
+ * constexpr faker::helper::WeightedSampler colors{std::array<faker::helper::WeightedElement<std::string_view>, 2>{
+ * {{3, "red"}, {1, "blue"}}}};
+ * colors() // "red"
+ * @endcode
+ */
+template <class T, std::size_t N = std::dynamic_extent>
+class WeightedSampler
+{
+public:
+    /**
+     * @param data The weighted elements.
+     *
+     * @throws std::invalid_argument if data is empty or the sum of weights is zero.
+     */
+    constexpr explicit WeightedSampler(std::span<const WeightedElement<T>, N> data)
+        : bucketBound_{checkedSize(data) - 1},
+          weightSum_{checkedWeightSum(data)},
+          thresholdBound_{weightSum_ - 1}
+    {
+        const auto size = data.size();
+
+        if constexpr (N == std::dynamic_extent)
+        {
+            values_.reserve(size);
+            thresholds_.resize(size);
+            aliases_.resize(size);
+        }
+
+        Storage<std::uint64_t> scaledWeights{};
+        Storage<std::size_t> small{};
+        Storage<std::size_t> large{};
+
+        if constexpr (N == std::dynamic_extent)
+        {
+            scaledWeights.resize(size);
+            small.resize(size);
+            large.resize(size);
+        }
+
+        std::size_t smallCount = 0;
+        std::size_t largeCount = 0;
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            if constexpr (N == std::dynamic_extent)
+            {
+                values_.push_back(data[i].value);
+            }
+            else
+            {
+                values_[i] = data[i].value;
+            }
+
+            // Every bucket has the capacity weightSum_, so the weights are scaled by the number of buckets.
+            scaledWeights[i] = std::uint64_t{data[i].weight} * size;
+
+            if (scaledWeights[i] < weightSum_)
+            {
+                small[smallCount++] = i;
+            }
+            else
+            {
+                large[largeCount++] = i;
+            }
+        }
+
+        while (smallCount != 0 && largeCount != 0)
+        {
+            const auto underfull = small[--smallCount];
+            const auto donor = large[largeCount - 1];
+
+            thresholds_[underfull] = scaledWeights[underfull];
+            aliases_[underfull] = donor;
+
+            scaledWeights[donor] -= weightSum_ - scaledWeights[underfull];
+
+            if (scaledWeights[donor] < weightSum_)
+            {
+                largeCount--;
+                small[smallCount++] = donor;
+            }
+        }
+
+        // The arithmetic is exact, so the remaining buckets are full.
+        while (largeCount != 0)
+        {
+            const auto full = large[--largeCount];
+
+            thresholds_[full] = weightSum_;
+            aliases_[full] = full;
+        }
+    }
+
+    /**
+     * @brief Draws a value using the thread's engine.
+     */
+    const T& operator()() const
+    {
+        return (*this)(random::engine());
+    }
+
+    /**
+     * @brief Draws a value using the given generator.
+     */
+    template <class Generator>
+        requires std::uniform_random_bit_generator<Generator>
+    const T& operator()(Generator& generator) const
+    {
+        const auto bucket = static_cast<std::size_t>(bucketBound_(generator));
+
+        if (thresholdBound_(generator) < thresholds_[bucket])
+        {
+            return values_[bucket];
+        }
+
+        return values_[aliases_[bucket]];
+    }
+
+    /**
+     * @brief Fills out with independently drawn values, the engine words are produced in blocks.
+     */
+    void operator()(std::span<T> out) const
+    {
+        random::WordBuffer words{out.size() * 2};
+
+        for (auto& value : out)
+        {
+            value = (*this)(words);
+        }
+    }
+
+    constexpr std::size_t size() const
+    {
+        return values_.size();
+    }
+
+private:
+    template <class U>
+    using Storage = std::conditional_t<N == std::dynamic_extent, std::vector<U>, std::array<U, N>>;
+
+    static constexpr std::size_t checkedSize(std::span<const WeightedElement<T>, N> data)
+    {
+        if (data.empty())
+        {
+            throw std::invalid_argument{"Data is empty."};
+        }
+
+        return data.size();
+    }
+
+    static constexpr std::uint64_t checkedWeightSum(std::span<const WeightedElement<T>, N> data)
+    {
+        std::uint64_t sum = 0;
+
+        for (const auto& element : data)
+        {
+            sum += element.weight;
+        }
+
+        if (sum == 0)
+        {
+            throw std::invalid_argument{"Sum of weights is zero."};
+        }
+
+        return sum;
+    }
+
+    random::UniformBound bucketBound_;
+    std::uint64_t weightSum_;
+    random::UniformBound thresholdBound_;
+    Storage<T> values_{};
+    Storage<std::uint64_t> thresholds_{};
+    Storage<std::size_t> aliases_{};
+};
+
+template <class T>
+WeightedSampler(const std::vector<WeightedElement<T>>&) -> WeightedSampler<T>;
+
+template <class T, std::size_t N>
+WeightedSampler(const std::array<WeightedElement<T>, N>&) -> WeightedSampler<T, N>;
+
+/**
+ * @brief Get a random element by weight from a vector.
+ *
+ * Scans the cumulative weights without allocating, callers drawing repeatedly from the same data should keep a
+ * `WeightedSampler` instead.
+ *
+ * @tparam T an element type of the weighted element.
+ *
+ * @param data vector of weighted elements.
+ *
+ * @return T a weighted element value from the vector.
+ *
+ * @code
+ * faker::helper::weightedArrayElement<std::string>(std::vector<helper::WeightedElement<std::string>>{{1, "value1"},
+ * {10, "value2"}}) // "hello2"
+ * @endcode
+ */
 template <class T>
 T weightedArrayElement(const std::vector<WeightedElement<T>>& data)
 {
@@ -147,17 +440,17 @@ T weightedArrayElement(const std::vector<WeightedElement<T>>& data)
     }
 
     const auto sumOfWeights =
-        std::accumulate(data.begin(), data.end(), 0u,
-                        [](unsigned sum, const WeightedElement<T>& element) { return sum + element.weight; });
+        std::accumulate(data.begin(), data.end(), std::uint64_t{0},
+                        [](std::uint64_t sum, const WeightedElement<T>& element) { return sum + element.weight; });
 
-    if (sumOfWeights == 0u)
+    if (sumOfWeights == 0)
     {
         throw std::invalid_argument{"Sum of weights is zero."};
     }
 
-    const std::integral auto targetWeightValue = number::integer<unsigned>(1, sumOfWeights);
+    const std::integral auto targetWeightValue = number::integer<std::uint64_t>(1, sumOfWeights);
 
-    unsigned currentSum = 0;
+    std::uint64_t currentSum = 0;
 
     size_t currentIdx = 0;
 
@@ -176,4 +469,53 @@ T weightedArrayElement(const std::vector<WeightedElement<T>>& data)
     return data.at(currentIdx).value;
 }
 
+/**
+ * @brief A mask of `#` and `!` placeholders, parsed once and rendered into pre-sized buffers.
+ *
+ * `#` (or the given symbol) becomes a digit between 0 and 9 and `!` a digit between 2 and 9, every other character is
+ * copied. Digits are cut from wide draws, one 64-bit word yields 18 decimal digits.
+ *
+ * @code
+ * const faker::helper::DigitTemplate phone{"!##-###-####"};
+ * phone() // "583-209-4481"
+ *
+ * std::string numbers(phone.size() * 100, ' ');
+ * phone.render(numbers) // 100 phone numbers back to back
+ * @endcode
+ */
+class FAKER_CXX_EXPORT DigitTemplate
+{
+public:
+    /**
+     * @param mask The characters to render.
+     * @param symbol The placeholder for digits between 0 and 9.
+     */
+    explicit DigitTemplate(std::string_view mask, char symbol = '#');
+
+    /**
+     * @brief Renders the mask once.
+     */
+    std::string operator()() const;
+
+    /**
+     * @brief Renders the mask into out as many times as it fits, words are drawn in blocks.
+     *
+     * @throws std::invalid_argument if the size of out is not a multiple of `size()`.
+     */
+    void render(std::span<char> out) const;
+
+    /**
+     * @returns The number of characters of one rendered mask.
+     */
+    std::size_t size() const;
+
+private:
+    template <class Generator>
+    void fill(std::span<char> out, Generator& generator) const;
+
+    std::string mask_;
+    // Positions of the 0-9 and 2-9 placeholders in mask_.
+    std::vector<std::size_t> digitPositions_;
+    std::vector<std::size_t> nonZeroDigitPositions_;
+};
 }
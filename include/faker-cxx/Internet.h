@@ -335,6 +335,21 @@ FAKER_CXX_EXPORT std::string domainWord();
  */
 FAKER_CXX_EXPORT std::string_view domainSuffix();
 
+/**
+ * @brief Generates a random domain suffix, with common suffixes far more frequent than rare ones.
+ *
+ * @param skew The Zipf exponent, see `helper::zipfArrayElement`. 0 gives the same distribution as `domainSuffix()`.
+ *
+ * @throws std::invalid_argument if skew is negative.
+ *
+ * @return Domain suffix.
+ *
+ * @code
+ * faker::internet::domainSuffix(1.2) // "com"
+ * @endcode
+ */
+FAKER_CXX_EXPORT std::string_view domainSuffix(double skew);
+
 /**
  * @brief Generates a random username.
  *
@@ -1,8 +1,19 @@
 #pragma once
 
+#include <array>
+#include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <random>
+#include <span>
 #include <stdexcept>
+#include <type_traits>
+
+#include "faker-cxx/Export.h"
+#include "faker-cxx/Random.h"
 
 namespace faker::number
 {
@@ -31,11 +42,13 @@ I integer(I min, I max)
         throw std::invalid_argument("Minimum value must be smaller than maximum value.");
     }
 
-    static std::mt19937 pseudoRandomGenerator{std::random_device{}()};
+    using U = std::make_unsigned_t<I>;
+
+    const auto maxOffset = static_cast<std::uint64_t>(static_cast<U>(static_cast<U>(max) - static_cast<U>(min)));
 
-    std::uniform_int_distribution<I> distribution(min, max);
+    const auto offset = random::UniformBound::draw(random::engine(), maxOffset);
 
-    return distribution(pseudoRandomGenerator);
+    return static_cast<I>(static_cast<U>(static_cast<U>(min) + static_cast<U>(offset)));
 }
 
 /**
@@ -60,6 +73,126 @@ I integer(I max)
     return integer<I>(static_cast<I>(0), max);
 }
 
+/**
+ * @brief Fills the given span with random integer numbers in the given range, bounds included.
+ *
+ * The range reduction is set up once for the whole span and the random words come from the vectorized
+ * `random::fill` kernel, so this is considerably faster than calling `integer` in a loop.
+ *
+ * @tparam I the type of the generated numbers, must be an integral type (int, long, long long, etc.).
+ *
+ * @param out The span to fill.
+ * @param min The minimum value of the range.
+ * @param max The maximum value of the range.
+ *
+ * @throws std::invalid_argument if min is greater than max.
+ *
+ * @code
+ * std::vector<int> values(1000);
+ * faker::number::integers<int>(values, 5, 10) // values = {7, 5, 10, 6, ...}
+ * @endcode
+ */
+template <std::integral I>
+void integers(std::span<I> out, std::type_identity_t<I> min, std::type_identity_t<I> max)
+{
+    if (min > max)
+    {
+        throw std::invalid_argument("Minimum value must be smaller than maximum value.");
+    }
+
+    using U = std::make_unsigned_t<I>;
+
+    const random::UniformBound bound{
+        static_cast<std::uint64_t>(static_cast<U>(static_cast<U>(max) - static_cast<U>(min)))};
+
+    random::WordBuffer words{out.size()};
+
+    for (auto& value : out)
+    {
+        value = static_cast<I>(static_cast<U>(static_cast<U>(min) + static_cast<U>(bound(words))));
+    }
+}
+
+/**
+ * @brief Writes the given count of random integer numbers in the given range, bounds included, to an output iterator.
+ *
+ * @tparam I the type of the generated numbers, must be an integral type (int, long, long long, etc.).
+ *
+ * @param out The output iterator.
+ * @param count The number of values to generate.
+ * @param min The minimum value of the range.
+ * @param max The maximum value of the range.
+ *
+ * @throws std::invalid_argument if min is greater than max.
+ *
+ * @return The output iterator past the last written value.
+ *
+ * @code
+ * std::vector<int> values;
+ * faker::number::integers(std::back_inserter(values), 1000, 5, 10)
+ * @endcode
+ */
+template <std::integral I, std::output_iterator<I> It>
+It integers(It out, std::size_t count, I min, I max)
+{
+    if (min > max)
+    {
+        throw std::invalid_argument("Minimum value must be smaller than maximum value.");
+    }
+
+    using U = std::make_unsigned_t<I>;
+
+    const random::UniformBound bound{
+        static_cast<std::uint64_t>(static_cast<U>(static_cast<U>(max) - static_cast<U>(min)))};
+
+    random::WordBuffer words{count};
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        *out++ = static_cast<I>(static_cast<U>(static_cast<U>(min) + static_cast<U>(bound(words))));
+    }
+
+    return out;
+}
+
+namespace detail
+{
+template <std::floating_point F>
+inline constexpr bool hasFastDecimalPath = std::numeric_limits<F>::digits <= 53;
+
+/**
+ * @brief Maps random words to [min, max] as min + u * (max - min) with u in [0, 1).
+ *
+ * Ranges wider than the largest finite value are mapped at half scale and doubled, which is exact.
+ */
+template <std::floating_point F>
+class DecimalRange
+{
+public:
+    DecimalRange(F min, F max)
+        : factor_{std::isfinite(max - min) ? F{1} : F{2}},
+          base_{min / factor_},
+          scale_{max / factor_ - min / factor_},
+          max_{max}
+    {
+    }
+
+    F operator()(std::uint64_t word) const
+    {
+        const F value = (base_ + random::toUnitInterval<F>(word) * scale_) * factor_;
+
+        // Rounding of the scaled offset can overshoot the upper bound by one ulp.
+        return value < max_ ? value : max_;
+    }
+
+private:
+    F factor_;
+    F base_;
+    F scale_;
+    F max_;
+};
+}
+
 /**
  * @brief Generates a random decimal number in the given range, bounds included.
  *
@@ -84,10 +217,16 @@ F decimal(F min, F max)
         throw std::invalid_argument("Minimum value must be smaller than maximum value.");
     }
 
-    static std::mt19937 pseudoRandomGenerator{std::random_device{}()};
-    std::uniform_real_distribution<F> distribution(min, max);
+    if constexpr (detail::hasFastDecimalPath<F>)
+    {
+        return detail::DecimalRange<F>{min, max}(random::engine()());
+    }
+    else
+    {
+        std::uniform_real_distribution<F> distribution(min, max);
 
-    return distribution(pseudoRandomGenerator);
+        return distribution(random::engine());
+    }
 }
 
     /**
@@ -112,4 +251,316 @@ F decimal(F min, F max)
         return decimal<F>(static_cast<F>(0.), max);
     }
 
+/**
+ * @brief Fills the given span with random decimal numbers in the given range, bounds included.
+ *
+ * The random words come from the vectorized `random::fill` kernel and the range mapping is set up once for the whole
+ * span, so this is considerably faster than calling `decimal` in a loop.
+ *
+ * @tparam F the type of the generated numbers, must be a floating point type (float, double, long double).
+ *
+ * @param out The span to fill.
+ * @param min The minimum value of the range.
+ * @param max The maximum value of the range.
+ *
+ * @throws std::invalid_argument if min is greater than max.
+ *
+ * @code
+ * std::vector<double> values(1000);
+ * faker::number::decimals<double>(values, 10.2, 17.7) // values = {15.6, 10.9, 12.3, ...}
+ * @endcode
+ */
+template <std::floating_point F>
+void decimals(std::span<F> out, std::type_identity_t<F> min, std::type_identity_t<F> max)
+{
+    if (min > max)
+    {
+        throw std::invalid_argument("Minimum value must be smaller than maximum value.");
+    }
+
+    if constexpr (detail::hasFastDecimalPath<F>)
+    {
+        const detail::DecimalRange<F> range{min, max};
+
+        random::WordBuffer words{out.size()};
+
+        for (auto& value : out)
+        {
+            value = range(words());
+        }
+    }
+    else
+    {
+        std::uniform_real_distribution<F> distribution(min, max);
+
+        for (auto& value : out)
+        {
+            value = distribution(random::engine());
+        }
+    }
+}
+
+/**
+ * @brief Generates a normally distributed random number.
+ *
+ * Uses a 256 layer ziggurat with tables computed once per process, so most draws take a single engine word and no
+ * transcendental function.
+ *
+ * @param mean The mean of the distribution.
+ * @param standardDeviation The standard deviation of the distribution.
+ *
+ * @throws std::invalid_argument if standardDeviation is negative.
+ *
+ * @return A normally distributed random number.
+ *
+ * @code
+ * faker::number::normal(170., 10.) // 176.3
+ * @endcode
+ */
+FAKER_CXX_EXPORT double normal(double mean = 0., double standardDeviation = 1.);
+
+/**
+ * @brief Fills the given span with normally distributed random numbers, see `normal`.
+ *
+ * @param out The span to fill.
+ * @param mean The mean of the distribution.
+ * @param standardDeviation The standard deviation of the distribution.
+ *
+ * @throws std::invalid_argument if standardDeviation is negative.
+ *
+ * @code
+ * std::vector<double> heights(1000);
+ * faker::number::normals(heights, 170., 10.) // heights = {176.3, 158.9, 171.2, ...}
+ * @endcode
+ */
+FAKER_CXX_EXPORT void normals(std::span<double> out, double mean = 0., double standardDeviation = 1.);
+
+/**
+ * @brief Generates a log-normally distributed random number, the exponential of a normally distributed number.
+ *
+ * @param logMean The mean of the underlying normal distribution.
+ * @param logStandardDeviation The standard deviation of the underlying normal distribution.
+ *
+ * @throws std::invalid_argument if logStandardDeviation is negative.
+ *
+ * @return A log-normally distributed random number, always positive.
+ *
+ * @code
+ * faker::number::lognormal(3., 0.5) // 24.7
+ * @endcode
+ */
+FAKER_CXX_EXPORT double lognormal(double logMean = 0., double logStandardDeviation = 1.);
+
+/**
+ * @brief Fills the given span with log-normally distributed random numbers, see `lognormal`.
+ *
+ * @param out The span to fill.
+ * @param logMean The mean of the underlying normal distribution.
+ * @param logStandardDeviation The standard deviation of the underlying normal distribution.
+ *
+ * @throws std::invalid_argument if logStandardDeviation is negative.
+ *
+ * @code
+ * std::vector<double> orderAmounts(1000);
+ * faker::number::lognormals(orderAmounts, 3., 0.5) // orderAmounts = {24.7, 12.9, 31.0, ...}
+ * @endcode
+ */
+FAKER_CXX_EXPORT void lognormals(std::span<double> out, double logMean = 0., double logStandardDeviation = 1.);
+
+/**
+ * @brief Generates an exponentially distributed random number.
+ *
+ * Uses a 256 layer ziggurat like `normal`.
+ *
+ * @param rate The rate of the distribution, the mean is 1 / rate.
+ *
+ * @throws std::invalid_argument if rate is not greater than zero.
+ *
+ * @return An exponentially distributed random number, never negative.
+ *
+ * @code
+ * faker::number::exponential(0.5) // 1.37
+ * @endcode
+ */
+FAKER_CXX_EXPORT double exponential(double rate = 1.);
+
+/**
+ * @brief Fills the given span with exponentially distributed random numbers, see `exponential`.
+ *
+ * @param out The span to fill.
+ * @param rate The rate of the distribution, the mean is 1 / rate.
+ *
+ * @throws std::invalid_argument if rate is not greater than zero.
+ *
+ * @code
+ * std::vector<double> gaps(1000);
+ * faker::number::exponentials(gaps, 0.5) // gaps = {1.37, 0.21, 4.02, ...}
+ * @endcode
+ */
+FAKER_CXX_EXPORT void exponentials(std::span<double> out, double rate = 1.);
+
+/**
+ * @brief Generates a Poisson distributed random number.
+ *
+ * Means below 10 use inversion by sequential search, larger means use Hörmann's transformed rejection (PTRS), so a
+ * draw takes constant expected time for any mean.
+ *
+ * @param mean The mean of the distribution.
+ *
+ * @throws std::invalid_argument if mean is negative, not finite or greater than 2^62.
+ *
+ * @return A Poisson distributed random number.
+ *
+ * @code
+ * faker::number::poisson(4.) // 3
+ * @endcode
+ */
+FAKER_CXX_EXPORT std::uint64_t poisson(double mean);
+
+/**
+ * @brief Fills the given span with Poisson distributed random numbers, see `poisson`.
+ *
+ * @param out The span to fill.
+ * @param mean The mean of the distribution.
+ *
+ * @throws std::invalid_argument if mean is negative, not finite or greater than 2^62.
+ *
+ * @code
+ * std::vector<std::uint64_t> visits(1000);
+ * faker::number::poissons(visits, 4.) // visits = {3, 6, 4, ...}
+ * @endcode
+ */
+FAKER_CXX_EXPORT void poissons(std::span<std::uint64_t> out, double mean);
+
+/**
+ * @brief Draws ranks from a Zipf distribution, rank k in [1, n] has probability proportional to 1 / k^exponent.
+ *
+ * Uses Hörmann and Derflinger's rejection-inversion, so construction and every draw take constant time and memory
+ * for any number of elements, including billions. An exponent of 0 gives a uniform distribution, larger exponents
+ * concentrate draws on the first ranks.
+ *
+ * @code
+ * const faker::number::ZipfSampler sampler{1000000, 1.1};
+ * sampler() // 3
+ * @endcode
+ */
+class FAKER_CXX_EXPORT ZipfSampler
+{
+public:
+    /**
+     * @param elementCount The number of ranks n.
+     * @param exponent The skew of the distribution.
+     *
+     * @throws std::invalid_argument if elementCount is zero or exponent is negative.
+     */
+    ZipfSampler(std::uint64_t elementCount, double exponent);
+
+    /**
+     * @brief Returns a rank in [1, n] drawn with the thread's engine.
+     */
+    std::uint64_t operator()() const;
+
+    /**
+     * @brief Fills the given span with ranks in [1, n].
+     */
+    void operator()(std::span<std::uint64_t> out) const;
+
+    std::uint64_t elementCount() const;
+
+    double exponent() const;
+
+private:
+    template <class Generator>
+    std::uint64_t sample(Generator& generator) const;
+
+    double h(double x) const;
+    double hIntegral(double x) const;
+    double hIntegralInverse(double x) const;
+
+    std::uint64_t elementCount_;
+    double exponent_;
+    double hIntegralX1_;
+    double hIntegralElementCount_;
+    double s_;
+};
+
+/**
+ * @brief Generates a Zipf distributed rank, see `ZipfSampler`.
+ *
+ * @param elementCount The number of ranks n.
+ * @param exponent The skew of the distribution.
+ *
+ * @throws std::invalid_argument if elementCount is zero or exponent is negative.
+ *
+ * @return A rank in [1, n], rank 1 being the most frequent.
+ *
+ * @code
+ * faker::number::zipf(100, 1.) // 2
+ * @endcode
+ */
+FAKER_CXX_EXPORT std::uint64_t zipf(std::uint64_t elementCount, double exponent);
+
+/**
+ * @brief A keyed pseudo-random permutation of the integers in [min, max].
+ *
+ * Index i maps to a value in [min, max] and distinct indices map to distinct values, so walking the indices 0, 1, 2...
+ * yields unique values without remembering the ones already issued. A balanced Feistel network shuffles the smallest
+ * even bit width covering the range and cycle-walking steps over results outside of it, which needs at most four
+ * steps on average. Every index is computed independently in constant time and memory, workers can split the index
+ * space between them, sharing only the key.
+ *
+ * @code
+ * const faker::number::Permutation customerIds{1, 1'000'000'000'000, 42};
+ * customerIds(0) // 896235822703
+ * customerIds(1) // 759565364671
+ * customerIds.inverse(759565364671) // 1
+ * @endcode
+ */
+class FAKER_CXX_EXPORT Permutation
+{
+public:
+    /**
+     * @param min The smallest value.
+     * @param max The largest value.
+     * @param key Selects the permutation, equal keys give equal permutations.
+     *
+     * @throws std::invalid_argument if min is greater than max.
+     */
+    Permutation(std::uint64_t min, std::uint64_t max, std::uint64_t key);
+
+    /**
+     * @brief A permutation with a key drawn from the thread's engine.
+     */
+    Permutation(std::uint64_t min, std::uint64_t max);
+
+    /**
+     * @throws std::invalid_argument if index is greater than `max - min`.
+     *
+     * @return The value at index.
+     */
+    std::uint64_t operator()(std::uint64_t index) const;
+
+    /**
+     * @throws std::invalid_argument if value is outside of [min, max].
+     *
+     * @return The index mapped to value.
+     */
+    std::uint64_t inverse(std::uint64_t value) const;
+
+    std::uint64_t min() const;
+    std::uint64_t max() const;
+
+private:
+    static constexpr unsigned roundCount = 8;
+
+    std::uint64_t encrypt(std::uint64_t block) const;
+    std::uint64_t decrypt(std::uint64_t block) const;
+    std::uint64_t round(unsigned index, std::uint64_t half) const;
+
+    std::uint64_t min_;
+    std::uint64_t maxOffset_;
+    unsigned halfBits_;
+    std::uint64_t halfMask_;
+    std::array<std::uint64_t, roundCount> roundKeys_;
+};
 }
@@ -0,0 +1,1312 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "faker-cxx/Export.h"
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace faker::random
+{
+namespace detail
+{
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 UInt128;
+#endif
+
+/**
+ * @brief Multiplies two 64-bit values, returns the high half of the 128-bit product and stores the low half.
+ */
+inline std::uint64_t multiplyHigh(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& low)
+{
+#if defined(__SIZEOF_INT128__)
+    const UInt128 product = static_cast<UInt128>(lhs) * rhs;
+    low = static_cast<std::uint64_t>(product);
+    return static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    std::uint64_t high;
+    low = _umul128(lhs, rhs, &high);
+    return high;
+#else
+    const std::uint64_t lhsLow = lhs & 0xffffffffu;
+    const std::uint64_t lhsHigh = lhs >> 32;
+    const std::uint64_t rhsLow = rhs & 0xffffffffu;
+    const std::uint64_t rhsHigh = rhs >> 32;
+
+    const std::uint64_t lowLow = lhsLow * rhsLow;
+    const std::uint64_t highLow = lhsHigh * rhsLow;
+    const std::uint64_t lowHigh = lhsLow * rhsHigh;
+    const std::uint64_t highHigh = lhsHigh * rhsHigh;
+
+    const std::uint64_t cross = (lowLow >> 32) + (highLow & 0xffffffffu) + lowHigh;
+
+    low = (cross << 32) | (lowLow & 0xffffffffu);
+    return highHigh + (highLow >> 32) + (cross >> 32);
+#endif
+}
+
+/**
+ * @brief Unsigned 128-bit integer with the wrapping arithmetic needed by 128-bit linear congruential generators.
+ */
+struct UInt128Parts
+{
+    std::uint64_t high;
+    std::uint64_t low;
+
+    friend UInt128Parts operator+(const UInt128Parts& lhs, const UInt128Parts& rhs)
+    {
+        const std::uint64_t low = lhs.low + rhs.low;
+        return {lhs.high + rhs.high + (low < lhs.low ? 1u : 0u), low};
+    }
+
+    friend UInt128Parts operator*(const UInt128Parts& lhs, const UInt128Parts& rhs)
+    {
+        std::uint64_t low;
+        const std::uint64_t high = multiplyHigh(lhs.low, rhs.low, low);
+        return {high + lhs.high * rhs.low + lhs.low * rhs.high, low};
+    }
+
+    bool operator==(const UInt128Parts&) const = default;
+};
+
+inline std::uint64_t rotateLeft(std::uint64_t value, int shift)
+{
+    return (value << shift) | (value >> (64 - shift));
+}
+
+inline std::uint64_t rotateRight(std::uint64_t value, unsigned shift)
+{
+    return (value >> shift) | (value << ((64u - shift) & 63u));
+}
+
+inline std::uint64_t splitMix64(std::uint64_t& state)
+{
+    std::uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Seed of a stream for engines whose streams are derived by hashing.
+ *
+ * The stream number goes through the splitmix finalizer alone, a bijection which maps only zero to zero, so every
+ * stream of a seed gets a distinct seed and stream `0` keeps the seed itself.
+ */
+inline std::uint64_t streamSeed(std::uint64_t seedValue, std::uint64_t stream)
+{
+    std::uint64_t state = stream - 0x9e3779b97f4a7c15ull;
+
+    return seedValue ^ splitMix64(state);
+}
+}
+
+/**
+ * @brief xoshiro256** generator by Blackman and Vigna: 256 bits of state, period 2^256 - 1.
+ *
+ * `jump` advances the state by 2^128 draws and `longJump` by 2^192 draws.
+ *
+ * Supports 2^64 streams per seed: a stream starts from a state hashed from (seed, stream) and moved one long jump,
+ * so streams are random points of the 2^256 period and never overlap in practice.
+ */
+class Xoshiro256StarStar
+{
+public:
+    using result_type = std::uint64_t;
+
+    explicit Xoshiro256StarStar(std::uint64_t seedValue = 0)
+    {
+        seed(seedValue);
+    }
+
+    void seed(std::uint64_t seedValue)
+    {
+        for (auto& word : state_)
+        {
+            word = detail::splitMix64(seedValue);
+        }
+    }
+
+    /**
+     * @brief Seeds the given stream in constant time, stream `0` matches `seed(seedValue)`.
+     */
+    void seed(std::uint64_t seedValue, std::uint64_t stream)
+    {
+        seed(detail::streamSeed(seedValue, stream));
+
+        // Keeps derived streams off the stream 0 sequences of other seeds.
+        if (stream != 0)
+        {
+            longJump();
+        }
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    result_type operator()()
+    {
+        const std::uint64_t result = detail::rotateLeft(state_[1] * 5, 7) * 9;
+        const std::uint64_t shifted = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= shifted;
+        state_[3] = detail::rotateLeft(state_[3], 45);
+
+        return result;
+    }
+
+    void jump()
+    {
+        applyPolynomial({0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull, 0xa9582618e03fc9aaull, 0x39abdc4529b1661cull});
+    }
+
+    void longJump()
+    {
+        applyPolynomial({0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull, 0x77710069854ee241ull, 0x39109bb02acbe635ull});
+    }
+
+    const std::array<std::uint64_t, 4>& state() const
+    {
+        return state_;
+    }
+
+    void setState(const std::array<std::uint64_t, 4>& state)
+    {
+        state_ = state;
+    }
+
+    bool operator==(const Xoshiro256StarStar&) const = default;
+
+private:
+    void applyPolynomial(const std::array<std::uint64_t, 4>& polynomial)
+    {
+        std::array<std::uint64_t, 4> jumped{};
+
+        for (const auto word : polynomial)
+        {
+            for (unsigned bit = 0; bit < 64; bit++)
+            {
+                if (word & (std::uint64_t{1} << bit))
+                {
+                    for (std::size_t i = 0; i < jumped.size(); i++)
+                    {
+                        jumped[i] ^= state_[i];
+                    }
+                }
+
+                (*this)();
+            }
+        }
+
+        state_ = jumped;
+    }
+
+    std::array<std::uint64_t, 4> state_{};
+};
+
+/**
+ * @brief PCG64 generator by O'Neill: 128-bit linear congruential state with the XSL RR output function.
+ *
+ * `jump` advances the state by 2^64 draws and `longJump` by 2^96 draws.
+ *
+ * Supports 2^32 non-overlapping streams of 2^96 draws per seed, stream numbers are taken modulo 2^32.
+ */
+class Pcg64
+{
+public:
+    using result_type = std::uint64_t;
+
+    explicit Pcg64(std::uint64_t seedValue = 0)
+    {
+        seed(seedValue);
+    }
+
+    void seed(std::uint64_t seedValue)
+    {
+        const detail::UInt128Parts initialState{detail::splitMix64(seedValue), detail::splitMix64(seedValue)};
+
+        increment_ = {detail::splitMix64(seedValue), detail::splitMix64(seedValue) | 1u};
+        state_ = {0, 0};
+        step();
+        state_ = state_ + initialState;
+        step();
+    }
+
+    /**
+     * @brief Seeds the given stream, which starts stream * 2^96 draws after stream `0`.
+     */
+    void seed(std::uint64_t seedValue, std::uint64_t stream)
+    {
+        seed(seedValue);
+        advance({stream << 32, 0});
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    result_type operator()()
+    {
+        step();
+
+        return detail::rotateRight(state_.high ^ state_.low, static_cast<unsigned>(state_.high >> 58));
+    }
+
+    void jump()
+    {
+        advance({1, 0});
+    }
+
+    void longJump()
+    {
+        advance({std::uint64_t{1} << 32, 0});
+    }
+
+    /**
+     * @brief Returns the 128-bit state and increment as {state high, state low, increment high, increment low}.
+     */
+    std::array<std::uint64_t, 4> state() const
+    {
+        return {state_.high, state_.low, increment_.high, increment_.low};
+    }
+
+    void setState(const std::array<std::uint64_t, 4>& state)
+    {
+        state_ = {state[0], state[1]};
+        increment_ = {state[2], state[3] | 1u};
+    }
+
+    bool operator==(const Pcg64&) const = default;
+
+private:
+    static constexpr detail::UInt128Parts multiplier{0x2360ed051fc65da4ull, 0x4385df649fccf645ull};
+
+    void step()
+    {
+        state_ = state_ * multiplier + increment_;
+    }
+
+    void advance(detail::UInt128Parts delta)
+    {
+        detail::UInt128Parts accumulatedMultiplier{0, 1};
+        detail::UInt128Parts accumulatedIncrement{0, 0};
+        detail::UInt128Parts currentMultiplier = multiplier;
+        detail::UInt128Parts currentIncrement = increment_;
+
+        while (delta.high != 0 || delta.low != 0)
+        {
+            if (delta.low & 1u)
+            {
+                accumulatedMultiplier = accumulatedMultiplier * currentMultiplier;
+                accumulatedIncrement = accumulatedIncrement * currentMultiplier + currentIncrement;
+            }
+
+            currentIncrement = (currentMultiplier + detail::UInt128Parts{0, 1}) * currentIncrement;
+            currentMultiplier = currentMultiplier * currentMultiplier;
+
+            delta = {delta.high >> 1, (delta.low >> 1) | (delta.high << 63)};
+        }
+
+        state_ = accumulatedMultiplier * state_ + accumulatedIncrement;
+    }
+
+    detail::UInt128Parts state_{};
+    detail::UInt128Parts increment_{};
+};
+
+/**
+ * @brief wyrand generator by Wang Yi: 64 bits of state, period 2^64.
+ *
+ * `jump` advances the state by 2^32 draws and `longJump` by 2^48 draws.
+ *
+ * Supports 2^64 streams per seed: a stream starts from a state hashed from (seed, stream), so streams are random
+ * points of the 2^64 period and k streams of n draws overlap with a probability of about k^2 * n / 2^64.
+ */
+class Wyrand
+{
+public:
+    using result_type = std::uint64_t;
+
+    explicit Wyrand(std::uint64_t seedValue = 0)
+    {
+        seed(seedValue);
+    }
+
+    void seed(std::uint64_t seedValue)
+    {
+        state_ = detail::splitMix64(seedValue);
+    }
+
+    /**
+     * @brief Seeds the given stream in constant time, stream `0` matches `seed(seedValue)`.
+     */
+    void seed(std::uint64_t seedValue, std::uint64_t stream)
+    {
+        seed(detail::streamSeed(seedValue, stream));
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    result_type operator()()
+    {
+        state_ += increment;
+
+        std::uint64_t low;
+        const std::uint64_t high = detail::multiplyHigh(state_, state_ ^ 0xe7037ed1a0b428dbull, low);
+
+        return high ^ low;
+    }
+
+    void jump()
+    {
+        state_ += increment << 32;
+    }
+
+    void longJump()
+    {
+        state_ += increment << 48;
+    }
+
+    std::uint64_t state() const
+    {
+        return state_;
+    }
+
+    void setState(std::uint64_t state)
+    {
+        state_ = state;
+    }
+
+    bool operator==(const Wyrand&) const = default;
+
+private:
+    static constexpr std::uint64_t increment{0xa0761d6478bd642full};
+
+    std::uint64_t state_{};
+};
+
+/**
+ * @brief Philox4x32-10 counter-based generator by Salmon et al.
+ *
+ * Every 128-bit output block is a keyed bijection of its counter, so any position of any stream is computed directly
+ * without generating the preceding values. The key is derived from the seed, the upper half of the counter holds the
+ * stream number and the lower half the block position inside the stream.
+ *
+ * `jump` moves to the next stream and `longJump` advances the stream number by 2^32.
+ *
+ * `seed(seed, stream)` supports 2^32 non-overlapping streams per seed, stream numbers are taken modulo 2^32.
+ */
+class Philox4x32
+{
+public:
+    using result_type = std::uint64_t;
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    explicit Philox4x32(std::uint64_t seedValue = 0, std::uint64_t stream = 0)
+    {
+        seed(seedValue, stream);
+    }
+
+    void seed(std::uint64_t seedValue)
+    {
+        key_ = {static_cast<std::uint32_t>(seedValue), static_cast<std::uint32_t>(seedValue >> 32)};
+        stream_ = 0;
+        position_ = 0;
+        cached_ = false;
+    }
+
+    /**
+     * @brief Seeds the given stream, which is `stream` long jumps after stream `0`.
+     */
+    void seed(std::uint64_t seedValue, std::uint64_t stream)
+    {
+        seed(seedValue);
+        stream_ = stream << 32;
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    result_type operator()()
+    {
+        if (!cached_ || (position_ & 1u) == 0)
+        {
+            const std::uint64_t blockIndex = position_ >> 1;
+
+            const auto block = generateBlock({static_cast<std::uint32_t>(blockIndex),
+                                              static_cast<std::uint32_t>(blockIndex >> 32),
+                                              static_cast<std::uint32_t>(stream_),
+                                              static_cast<std::uint32_t>(stream_ >> 32)},
+                                             key_);
+
+            block_ = {(static_cast<std::uint64_t>(block[1]) << 32) | block[0],
+                      (static_cast<std::uint64_t>(block[3]) << 32) | block[2]};
+            cached_ = true;
+        }
+
+        return block_[position_++ & 1u];
+    }
+
+    /**
+     * @brief Skips the given number of draws in constant time.
+     */
+    void discard(std::uint64_t count)
+    {
+        position_ += count;
+        cached_ = false;
+    }
+
+    void jump()
+    {
+        stream_ += 1;
+        cached_ = false;
+    }
+
+    void longJump()
+    {
+        stream_ += std::uint64_t{1} << 32;
+        cached_ = false;
+    }
+
+    std::uint64_t stream() const
+    {
+        return stream_;
+    }
+
+    std::uint64_t position() const
+    {
+        return position_;
+    }
+
+    const Key& key() const
+    {
+        return key_;
+    }
+
+    /**
+     * @brief Moves the engine to the given draw of the stream, the counterpart of `key`, `stream` and `position`.
+     */
+    void setState(const Key& key, std::uint64_t stream, std::uint64_t position)
+    {
+        key_ = key;
+        stream_ = stream;
+        position_ = position;
+        cached_ = false;
+    }
+
+    /**
+     * @brief Computes the ten round Philox bijection of a counter under a key.
+     */
+    static Counter generateBlock(Counter counter, Key key)
+    {
+        for (int round = 0; round < 10; round++)
+        {
+            const std::uint64_t firstProduct = std::uint64_t{0xd2511f53u} * counter[0];
+            const std::uint64_t secondProduct = std::uint64_t{0xcd9e8d57u} * counter[2];
+
+            counter = {static_cast<std::uint32_t>(secondProduct >> 32) ^ counter[1] ^ key[0],
+                       static_cast<std::uint32_t>(secondProduct),
+                       static_cast<std::uint32_t>(firstProduct >> 32) ^ counter[3] ^ key[1],
+                       static_cast<std::uint32_t>(firstProduct)};
+
+            key[0] += 0x9e3779b9u;
+            key[1] += 0xbb67ae85u;
+        }
+
+        return counter;
+    }
+
+    bool operator==(const Philox4x32& other) const
+    {
+        return key_ == other.key_ && stream_ == other.stream_ && position_ == other.position_;
+    }
+
+private:
+    Key key_{};
+    std::uint64_t stream_;
+    std::uint64_t position_{};
+    std::array<std::uint64_t, 2> block_{};
+    bool cached_{false};
+};
+
+enum class EngineType
+{
+    Xoshiro256StarStar,
+    Pcg64,
+    Wyrand,
+    Philox4x32,
+};
+
+/**
+ * @brief The engine every module of the library draws from, runs one of the algorithms listed in `EngineType`.
+ *
+ * Satisfies `std::uniform_random_bit_generator`, so it can be used with the standard distributions and with
+ * `RandomGenerator`.
+ */
+class Engine
+{
+public:
+    using result_type = std::uint64_t;
+    using State = std::array<std::uint64_t, 4>;
+
+    explicit Engine(std::uint64_t seedValue = 0, EngineType type = EngineType::Xoshiro256StarStar)
+        : type_{type}
+    {
+        seed(seedValue);
+    }
+
+    Engine(std::uint64_t seedValue, std::uint64_t stream, EngineType type) : type_{type}
+    {
+        seed(seedValue, stream);
+    }
+
+    explicit Engine(const Philox4x32& philox4x32) : type_{EngineType::Philox4x32}, philox4x32_{philox4x32} {}
+
+    EngineType type() const
+    {
+        return type_;
+    }
+
+    void seed(std::uint64_t seedValue)
+    {
+        switch (type_)
+        {
+        case EngineType::Pcg64:
+            pcg64_.seed(seedValue);
+            break;
+        case EngineType::Wyrand:
+            wyrand_.seed(seedValue);
+            break;
+        case EngineType::Philox4x32:
+            philox4x32_.seed(seedValue);
+            break;
+        default:
+            xoshiro256StarStar_.seed(seedValue);
+        }
+    }
+
+    /**
+     * @brief Seeds the given stream of the active algorithm in constant time, see the algorithms for their stream
+     * counts.
+     */
+    void seed(std::uint64_t seedValue, std::uint64_t stream)
+    {
+        switch (type_)
+        {
+        case EngineType::Pcg64:
+            pcg64_.seed(seedValue, stream);
+            break;
+        case EngineType::Wyrand:
+            wyrand_.seed(seedValue, stream);
+            break;
+        case EngineType::Philox4x32:
+            philox4x32_.seed(seedValue, stream);
+            break;
+        default:
+            xoshiro256StarStar_.seed(seedValue, stream);
+        }
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    result_type operator()()
+    {
+        switch (type_)
+        {
+        case EngineType::Pcg64:
+            return pcg64_();
+        case EngineType::Wyrand:
+            return wyrand_();
+        case EngineType::Philox4x32:
+            return philox4x32_();
+        default:
+            return xoshiro256StarStar_();
+        }
+    }
+
+    void jump()
+    {
+        switch (type_)
+        {
+        case EngineType::Pcg64:
+            pcg64_.jump();
+            break;
+        case EngineType::Wyrand:
+            wyrand_.jump();
+            break;
+        case EngineType::Philox4x32:
+            philox4x32_.jump();
+            break;
+        default:
+            xoshiro256StarStar_.jump();
+        }
+    }
+
+    void longJump()
+    {
+        switch (type_)
+        {
+        case EngineType::Pcg64:
+            pcg64_.longJump();
+            break;
+        case EngineType::Wyrand:
+            wyrand_.longJump();
+            break;
+        case EngineType::Philox4x32:
+            philox4x32_.longJump();
+            break;
+        default:
+            xoshiro256StarStar_.longJump();
+        }
+    }
+
+    /**
+     * @brief Returns the state of the active algorithm packed into four words, see `setState`.
+     *
+     * xoshiro256** and PCG64 use all four words, wyrand the first word and Philox4x32 the first three words
+     * (key, stream, position).
+     */
+    State state() const
+    {
+        switch (type_)
+        {
+        case EngineType::Pcg64:
+            return pcg64_.state();
+        case EngineType::Wyrand:
+            return {wyrand_.state(), 0, 0, 0};
+        case EngineType::Philox4x32:
+        {
+            const auto& key = philox4x32_.key();
+
+            return {(static_cast<std::uint64_t>(key[1]) << 32) | key[0], philox4x32_.stream(), philox4x32_.position(),
+                    0};
+        }
+        default:
+            return xoshiro256StarStar_.state();
+        }
+    }
+
+    /**
+     * @brief Switches the engine to the given algorithm and state, the exact inverse of `type` and `state`.
+     */
+    void setState(EngineType type, const State& state)
+    {
+        type_ = type;
+
+        switch (type_)
+        {
+        case EngineType::Pcg64:
+            pcg64_.setState(state);
+            break;
+        case EngineType::Wyrand:
+            wyrand_.setState(state[0]);
+            break;
+        case EngineType::Philox4x32:
+            philox4x32_.setState({static_cast<std::uint32_t>(state[0]), static_cast<std::uint32_t>(state[0] >> 32)},
+                                 state[1], state[2]);
+            break;
+        default:
+            xoshiro256StarStar_.setState(state);
+        }
+    }
+
+    bool operator==(const Engine&) const = default;
+
+private:
+    EngineType type_;
+    Xoshiro256StarStar xoshiro256StarStar_;
+    Pcg64 pcg64_;
+    Wyrand wyrand_;
+    Philox4x32 philox4x32_;
+};
+
+/**
+ * @brief Maps 64-bit engine output to integers uniformly distributed in `[0, maxOffset]`.
+ *
+ * Uses Lemire's multiply-shift reduction: the high half of `word * (maxOffset + 1)` is the result and the low half
+ * decides the rare rejections. The rejection threshold is computed once per instance, so repeated draws from the same
+ * range need no division at all.
+ */
+class UniformBound
+{
+public:
+    constexpr explicit UniformBound(std::uint64_t maxOffset)
+        : range_{maxOffset + 1}, threshold_{computeThreshold(range_)}
+    {
+    }
+
+    template <class Generator>
+    std::uint64_t operator()(Generator& generator) const
+    {
+        if (range_ == 0)
+        {
+            return generator();
+        }
+
+        std::uint64_t low;
+        std::uint64_t high = detail::multiplyHigh(generator(), range_, low);
+
+        while (low < threshold_)
+        {
+            high = detail::multiplyHigh(generator(), range_, low);
+        }
+
+        return high;
+    }
+
+    /**
+     * @brief Draws a single value, the threshold division only happens when the first word lands in the
+     * rejection zone.
+     */
+    template <class Generator>
+    static std::uint64_t draw(Generator& generator, std::uint64_t maxOffset)
+    {
+        const std::uint64_t range = maxOffset + 1;
+
+        if (range == 0)
+        {
+            return generator();
+        }
+
+        std::uint64_t low;
+        std::uint64_t high = detail::multiplyHigh(generator(), range, low);
+
+        if (low < range)
+        {
+            const std::uint64_t threshold = computeThreshold(range);
+
+            while (low < threshold)
+            {
+                high = detail::multiplyHigh(generator(), range, low);
+            }
+        }
+
+        return high;
+    }
+
+private:
+    static constexpr std::uint64_t computeThreshold(std::uint64_t range)
+    {
+        return range == 0 ? 0 : (0 - range) % range;
+    }
+
+    std::uint64_t range_;
+    std::uint64_t threshold_;
+};
+
+/**
+ * @brief Maps a random 64-bit word to a uniformly distributed value in [0, 1).
+ *
+ * Uses the top 53 bits of the word for double and the top 24 bits for float, so every representable multiple of
+ * 2^-53 (2^-24) is equally likely.
+ *
+ * @tparam F float or double.
+ *
+ * @param word The random word.
+ *
+ * @returns Value in the range [0, 1).
+ *
+ * @code
+ * faker::random::toUnitInterval<double>(faker::random::engine()()) // 0.318
+ * @endcode
+ */
+template <std::floating_point F>
+    requires(std::numeric_limits<F>::digits <= 53)
+F toUnitInterval(std::uint64_t word)
+{
+    constexpr int digits = std::numeric_limits<F>::digits;
+
+    return static_cast<F>(word >> (64 - digits)) * (F{1} / static_cast<F>(std::uint64_t{1} << digits));
+}
+
+/**
+ * @brief Returns the random engine of the calling thread.
+ *
+ * Every thread owns its own engine, so generators can be called concurrently without locks.
+ * Until `setSeed` is called engines are seeded from `std::random_device`.
+ *
+ * @returns Reference to the thread local engine.
+ *
+ * @code
+ * std::uniform_int_distribution<int> distribution(1, 6);
+ * distribution(faker::random::engine()) // 4
+ * @endcode
+ */
+FAKER_CXX_EXPORT Engine& engine();
+
+/**
+ * @brief Seeds the engines of all threads, making generated data reproducible.
+ *
+ * The calling thread is reseeded immediately with stream `0`, other threads are reseeded lazily on their next draw.
+ * Threads which did not pin a stream with `setStream` get consecutive stream numbers in order of their first draw.
+ * Streams are seeded in constant time. xoshiro256** and wyrand derive stream `n` from (seed, n) and support 2^64
+ * streams, PCG64 and Philox4x32 start stream `n` exactly `n` long jumps after stream `0` and support 2^32 streams.
+ *
+ * @param seed The seed value.
+ *
+ * @code
+ * faker::random::setSeed(42);
+ * faker::number::integer(1, 100) // always the same value for seed 42
+ * @endcode
+ */
+FAKER_CXX_EXPORT void setSeed(std::uint64_t seed);
+
+/**
+ * @brief Pins the stream number of the calling thread's engine.
+ *
+ * A seeded engine is derived from the pair (seed, stream), so pinning a stream per worker makes multi-threaded
+ * generation reproducible regardless of thread scheduling.
+ *
+ * @param stream The stream number of the calling thread.
+ *
+ * @code
+ * faker::random::setSeed(42);
+ * // in worker thread number 3
+ * faker::random::setStream(3);
+ * @endcode
+ */
+FAKER_CXX_EXPORT void setStream(std::uint64_t stream);
+
+/**
+ * @brief Selects the algorithm of the engines of all threads.
+ *
+ * The default is chosen at build time with the `FAKER_CXX_DEFAULT_ENGINE` CMake option.
+ * Engines are recreated as after `setSeed`, so a seeded run stays reproducible.
+ *
+ * @param type The engine algorithm.
+ *
+ * @code
+ * faker::random::setEngineType(faker::random::EngineType::Wyrand);
+ * @endcode
+ */
+FAKER_CXX_EXPORT void setEngineType(EngineType type);
+
+/**
+ * @brief Returns the algorithm currently used by the engines.
+ *
+ * @returns Engine algorithm.
+ *
+ * @code
+ * faker::random::engineType() // EngineType::Xoshiro256StarStar
+ * @endcode
+ */
+FAKER_CXX_EXPORT EngineType engineType();
+
+/**
+ * @brief Buffered source of single bits for small-range draws.
+ *
+ * Digits, nibbles and coin flips need only a few bits each, so the pool hands out exactly as many bits as a draw
+ * needs and refills from the thread's engine once its 64-bit buffer runs dry. A decimal digit takes eight bits and
+ * a hexadecimal nibble four, so one engine call covers eight digits or sixteen nibbles instead of one.
+ *
+ * @code
+ * auto& pool = faker::random::entropyPool();
+ * const auto digit = pool.uniform(10);
+ * @endcode
+ */
+class EntropyPool
+{
+public:
+    /**
+     * @brief Returns the given number of random bits.
+     *
+     * @param count The number of bits, from 1 to 64.
+     *
+     * @returns Value in the range [0, 2^count).
+     */
+    std::uint64_t bits(unsigned count)
+    {
+        if (count > available_)
+        {
+            buffer_ = engine()();
+            available_ = 64;
+        }
+
+        const auto value = count == 64 ? buffer_ : buffer_ & ((std::uint64_t{1} << count) - 1);
+
+        buffer_ = count == 64 ? 0 : buffer_ >> count;
+        available_ -= count;
+
+        return value;
+    }
+
+    /**
+     * @brief Returns a uniformly distributed value in [0, bound).
+     *
+     * Powers of two take exactly their bit width. Other bounds map four extra bits with Lemire's multiply-shift and
+     * reject the few biased values, so the result has no bias and fewer than one in sixteen draws is retried.
+     *
+     * @param bound The exclusive upper bound, must be greater than zero.
+     *
+     * @returns Value in the range [0, bound).
+     */
+    std::uint64_t uniform(std::uint64_t bound)
+    {
+        if ((bound & (bound - 1)) == 0)
+        {
+            return bound <= 1 ? 0 : bits(static_cast<unsigned>(std::countr_zero(bound)));
+        }
+
+        const auto width = static_cast<unsigned>(std::bit_width(bound)) + 4;
+
+        if (width > 32)
+        {
+            return UniformBound::draw(engine(), bound - 1);
+        }
+
+        const auto mask = (std::uint64_t{1} << width) - 1;
+
+        auto product = bits(width) * bound;
+
+        if ((product & mask) < bound)
+        {
+            const auto threshold = (mask + 1) % bound;
+
+            while ((product & mask) < threshold)
+            {
+                product = bits(width) * bound;
+            }
+        }
+
+        return product >> width;
+    }
+
+    /**
+     * @brief Returns a fair coin flip using a single bit.
+     */
+    bool boolean()
+    {
+        return bits(1) != 0;
+    }
+
+    /**
+     * @brief Drops the buffered bits, the next draw refills from the engine.
+     */
+    void clear()
+    {
+        buffer_ = 0;
+        available_ = 0;
+    }
+
+    /**
+     * @brief Returns the buffered bits, the lowest `available()` bits are handed out next.
+     */
+    std::uint64_t buffer() const
+    {
+        return buffer_;
+    }
+
+    unsigned available() const
+    {
+        return available_;
+    }
+
+    /**
+     * @param available The number of buffered bits, at most 64.
+     */
+    void setState(std::uint64_t buffer, unsigned available)
+    {
+        buffer_ = buffer;
+        available_ = (std::min)(available, 64u);
+    }
+
+    bool operator==(const EntropyPool&) const = default;
+
+private:
+    std::uint64_t buffer_{0};
+    unsigned available_{0};
+};
+
+/**
+ * @brief Returns the entropy pool of the calling thread.
+ *
+ * The pool is emptied whenever the thread's engine is reseeded and is saved and restored by `RecordScope`, so seeded
+ * output stays reproducible. Keep the reference within a single generator call.
+ *
+ * @returns Reference to the thread local entropy pool.
+ *
+ * @code
+ * faker::random::entropyPool().boolean() // true
+ * @endcode
+ */
+FAKER_CXX_EXPORT EntropyPool& entropyPool();
+
+/**
+ * @brief Runs the generators of the calling thread under a record context while the scope is alive.
+ *
+ * Inside the scope every module draws from a Philox4x32 stream derived only from the pair (seed, record index), so
+ * record `n` of a dataset is generated directly, independent of other records, threads or machines. The previous
+ * engine of the thread is restored when the scope ends. Scopes can be nested.
+ *
+ * @code
+ * for (std::uint64_t row = firstRow; row < lastRow; row++)
+ * {
+ *     faker::random::RecordScope record{datasetSeed, row};
+ *     const auto name = faker::person::fullName(); // same value for (datasetSeed, row) on every run
+ * }
+ * @endcode
+ */
+class FAKER_CXX_EXPORT RecordScope
+{
+public:
+    /**
+     * @param seed The dataset seed.
+     * @param recordIndex The index of the record.
+     */
+    RecordScope(std::uint64_t seed, std::uint64_t recordIndex);
+
+    /**
+     * @brief Uses the seed passed to `setSeed`, or `0` if the library was not seeded.
+     *
+     * @param recordIndex The index of the record.
+     */
+    explicit RecordScope(std::uint64_t recordIndex);
+
+    ~RecordScope();
+
+    RecordScope(const RecordScope&) = delete;
+    RecordScope& operator=(const RecordScope&) = delete;
+
+private:
+    Engine previousEngine_;
+    EntropyPool previousPool_;
+};
+
+class Snapshot;
+
+/**
+ * @brief Captures the random state of the calling thread.
+ *
+ * Other threads are not affected, every worker takes its own snapshot.
+ *
+ * @returns Snapshot of the calling thread.
+ */
+FAKER_CXX_EXPORT Snapshot snapshot();
+
+/**
+ * @brief Replaces the random state of the calling thread with the given snapshot.
+ *
+ * The restored state is kept until the next `setSeed` or `setEngineType`, which reseed every thread.
+ * A snapshot can be restored any number of times and in any thread.
+ *
+ * @param snapshot The snapshot to restore.
+ */
+FAKER_CXX_EXPORT void restore(const Snapshot& snapshot);
+
+/**
+ * @brief The random state of a thread: its engine, the lanes used by `fill` and the entropy pool.
+ *
+ * Taken with `snapshot` and applied with `restore`, a snapshot makes the thread repeat the exact same draws, so a
+ * batch can be regenerated or a scenario branched from a checkpoint. `serialize` encodes it into at most 300 bytes
+ * that `deserialize` decodes exactly, on any platform.
+ *
+ * @code
+ * const auto checkpoint = faker::random::snapshot();
+ * const auto first = faker::person::fullName();
+ * faker::random::restore(checkpoint);
+ * faker::person::fullName() // same as first
+ * @endcode
+ */
+class FAKER_CXX_EXPORT Snapshot
+{
+public:
+    /**
+     * @brief Encodes the snapshot into bytes, integers are stored little endian.
+     */
+    std::vector<std::uint8_t> serialize() const;
+
+    /**
+     * @brief Decodes bytes produced by `serialize`.
+     *
+     * @throws std::invalid_argument if the bytes are not a valid serialized snapshot.
+     */
+    static Snapshot deserialize(std::span<const std::uint8_t> bytes);
+
+    bool operator==(const Snapshot&) const = default;
+
+private:
+    friend Snapshot snapshot();
+    friend void restore(const Snapshot& snapshot);
+
+    Snapshot() = default;
+
+    EngineType engineType_{EngineType::Xoshiro256StarStar};
+    Engine::State engineState_{};
+    EntropyPool pool_;
+    bool lanesSeeded_{false};
+    std::array<std::uint64_t, 32> laneState_{};
+};
+
+enum class InstructionSet
+{
+    Scalar,
+    Avx2,
+    Avx512,
+};
+
+/**
+ * @brief Fills the given span with random 64-bit words.
+ *
+ * Words come from eight independent xoshiro256** lanes per thread, seeded from the thread's engine and stepped
+ * together with AVX2 or AVX-512 when the CPU supports it. The output for a given seed does not depend on the
+ * instruction set.
+ *
+ * @param words The span to fill.
+ *
+ * @code
+ * std::vector<std::uint64_t> words(1024);
+ * faker::random::fill(words);
+ * @endcode
+ */
+FAKER_CXX_EXPORT void fill(std::span<std::uint64_t> words);
+
+/**
+ * @brief Fills the given span with random bytes, see `fill`.
+ *
+ * @param bytes The span to fill.
+ *
+ * @code
+ * std::array<std::uint8_t, 16> bytes;
+ * faker::random::fillBytes(bytes);
+ * @endcode
+ */
+FAKER_CXX_EXPORT void fillBytes(std::span<std::uint8_t> bytes);
+
+/**
+ * @brief Returns the instruction set used by `fill`, by default the best one supported by the CPU.
+ *
+ * @returns Instruction set.
+ *
+ * @code
+ * faker::random::instructionSet() // InstructionSet::Avx2
+ * @endcode
+ */
+FAKER_CXX_EXPORT InstructionSet instructionSet();
+
+/**
+ * @brief Checks whether the CPU supports the given instruction set.
+ *
+ * @param instructionSet The instruction set to check.
+ *
+ * @returns True if `setInstructionSet` accepts the instruction set.
+ *
+ * @code
+ * faker::random::isSupported(faker::random::InstructionSet::Avx512) // false
+ * @endcode
+ */
+FAKER_CXX_EXPORT bool isSupported(InstructionSet instructionSet);
+
+/**
+ * @brief Selects the instruction set used by `fill` in all threads.
+ *
+ * @param instructionSet The instruction set to use.
+ *
+ * @throws std::invalid_argument if the CPU does not support the instruction set.
+ *
+ * @code
+ * faker::random::setInstructionSet(faker::random::InstructionSet::Scalar);
+ * @endcode
+ */
+FAKER_CXX_EXPORT void setInstructionSet(InstructionSet instructionSet);
+
+/**
+ * @brief Uniform random bit generator serving words produced in blocks by `fill`, backs the bulk generators.
+ */
+class WordBuffer
+{
+public:
+    using result_type = std::uint64_t;
+
+    static constexpr std::size_t capacity = 256;
+
+    /**
+     * @param expectedDraws The number of words the caller expects to draw, limits the block size of small requests.
+     */
+    explicit WordBuffer(std::size_t expectedDraws = capacity)
+        : size_{(std::min)(capacity, (expectedDraws + 7) / 8 * 8)}, index_{size_}
+    {
+        if (size_ == 0)
+        {
+            size_ = 8;
+            index_ = size_;
+        }
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    result_type operator()()
+    {
+        if (index_ == size_)
+        {
+            fill(std::span<std::uint64_t>{words_.data(), size_});
+            index_ = 0;
+        }
+
+        return words_[index_++];
+    }
+
+private:
+    std::array<std::uint64_t, capacity> words_;
+    std::size_t size_;
+    std::size_t index_;
+};
+}
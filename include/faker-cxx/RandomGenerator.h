@@ -1,6 +1,10 @@
 #pragma once
 
 #include <random>
+#include <type_traits>
+#include <utility>
+
+#include "Random.h"
 
 namespace faker
 {
@@ -9,7 +13,12 @@ template <typename T>
 class RandomGenerator
 {
 public:
-    RandomGenerator() : generator_{T(std::random_device{}())} {}
+    RandomGenerator() : generator_{makeGenerator()} {}
+
+    /**
+     * @brief Continues from the given generator, for example an engine restored with `random::Engine::setState`.
+     */
+    explicit RandomGenerator(T generator) : generator_{std::move(generator)} {}
 
     ~RandomGenerator() = default;
 
@@ -23,7 +32,24 @@ public:
         return dist(generator_);
     }
 
+    const T& generator() const
+    {
+        return generator_;
+    }
+
 private:
+    static T makeGenerator()
+    {
+        if constexpr (std::is_same_v<T, random::Engine>)
+        {
+            return random::Engine{random::engine()(), random::engineType()};
+        }
+        else
+        {
+            return T(random::engine()());
+        }
+    }
+
     T generator_;
 };
 }
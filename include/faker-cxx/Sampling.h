@@ -0,0 +1,752 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "faker-cxx/Export.h"
+#include "Random.h"
+
+namespace faker::helper
+{
+/**
+ * @brief Draws distinct indices from `[0, size)` in random order.
+ *
+ * Sparse requests use Floyd's algorithm, which needs one draw per index and memory proportional to count, followed by a
+ * shuffle of the result. Requests covering a large part of the range use a partial Fisher-Yates shuffle instead.
+ *
+ * @param size The number of indices to choose from.
+ * @param count The number of indices to draw.
+ * @param generator The random bit generator.
+ *
+ * @throws std::invalid_argument if count is greater than size.
+ *
+ * @return count distinct indices, every ordered selection is equally likely.
+ *
+ * @code
+ * faker::helper::distinctIndices(10, 3, faker::random::engine()) // {7, 0, 4}
+ * @endcode
+ */
+template <class Generator>
+    requires std::uniform_random_bit_generator<Generator>
+std::vector<std::size_t> distinctIndices(std::size_t size, std::size_t count, Generator& generator)
+{
+    if (count > size)
+    {
+        throw std::invalid_argument{"Count is greater than the number of elements."};
+    }
+
+    std::vector<std::size_t> indices;
+
+    // Below this density the O(size) index table of Fisher-Yates costs more than Floyd's membership checks.
+    if (count > size / 8)
+    {
+        indices.resize(size);
+
+        std::iota(indices.begin(), indices.end(), std::size_t{0});
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const auto j = i + static_cast<std::size_t>(random::UniformBound::draw(generator, size - 1 - i));
+
+            std::swap(indices[i], indices[j]);
+        }
+
+        indices.resize(count);
+
+        return indices;
+    }
+
+    indices.reserve(count);
+
+    // Small selections are checked by a linear scan, larger ones by a bitmap when it stays within a few words per
+    // drawn index and by a hash set otherwise.
+    constexpr std::size_t linearScanLimit = 32;
+    constexpr std::size_t bitmapWordsPerIndex = 8;
+
+    const bool useLinearScan = count <= linearScanLimit;
+    const bool useBitmap = !useLinearScan && size / 64 <= count * bitmapWordsPerIndex;
+
+    std::vector<std::uint64_t> bitmap;
+    std::unordered_set<std::size_t> chosen;
+
+    if (useBitmap)
+    {
+        bitmap.resize(size / 64 + 1);
+    }
+    else if (!useLinearScan)
+    {
+        chosen.reserve(count);
+    }
+
+    for (auto j = size - count; j < size; j++)
+    {
+        auto index = static_cast<std::size_t>(random::UniformBound::draw(generator, j));
+
+        bool taken;
+
+        if (useLinearScan)
+        {
+            taken = std::find(indices.begin(), indices.end(), index) != indices.end();
+        }
+        else if (useBitmap)
+        {
+            taken = (bitmap[index / 64] >> (index % 64) & 1) != 0;
+        }
+        else
+        {
+            taken = chosen.contains(index);
+        }
+
+        if (taken)
+        {
+            index = j;
+        }
+
+        if (useBitmap)
+        {
+            bitmap[index / 64] |= std::uint64_t{1} << (index % 64);
+        }
+        else if (!useLinearScan)
+        {
+            chosen.insert(index);
+        }
+
+        indices.push_back(index);
+    }
+
+    // Floyd's algorithm selects a uniform subset but not a uniform order.
+    for (auto i = indices.size(); i > 1; i--)
+    {
+        std::swap(indices[i - 1], indices[static_cast<std::size_t>(random::UniformBound::draw(generator, i - 1))]);
+    }
+
+    return indices;
+}
+
+/**
+ * @brief Draws distinct indices from `[0, size)` in random order using the thread's engine.
+ */
+inline std::vector<std::size_t> distinctIndices(std::size_t size, std::size_t count)
+{
+    return distinctIndices(size, count, random::engine());
+}
+
+/**
+ * @brief Get count distinct elements from a span, without copying them.
+ *
+ * Elements are distinct by position, equal values stored twice in data can both be drawn. See `distinctIndices` for the
+ * algorithm.
+ *
+ * @tparam T an element type of the span.
+ *
+ * @param data The span.
+ * @param count The number of elements to draw.
+ *
+ * @throws std::invalid_argument if count is greater than the size of data.
+ *
+ * @return References to count elements of data in random order.
+ *
+ * @code
+ * const std::vector<std::string> hobbies{"chess", "hiking", "piano", "surfing"};
+ * faker::helper::arrayElements<std::string>(hobbies, 2) // {"piano", "chess"}
+ * @endcode
+ */
+template <class T>
+std::vector<std::reference_wrapper<const T>> arrayElements(std::span<const T> data, std::size_t count)
+{
+    const auto indices = distinctIndices(data.size(), count);
+
+    std::vector<std::reference_wrapper<const T>> elements;
+
+    elements.reserve(indices.size());
+
+    for (const auto index : indices)
+    {
+        elements.push_back(std::cref(data[index]));
+    }
+
+    return elements;
+}
+
+template <typename T, std::size_t N>
+std::vector<std::reference_wrapper<const T>> arrayElements(const std::array<T, N>& data, std::size_t count)
+{
+    return arrayElements(std::span<const T>{data}, count);
+}
+
+namespace detail
+{
+// A uniform double in (0, 1], so its logarithm is finite.
+inline double positiveUnitDraw()
+{
+    return 1 - random::toUnitInterval<double>(random::engine()());
+}
+}
+
+/**
+ * @brief Keeps a uniform random sample of k elements of a stream of unknown length.
+ *
+ * Uses Li's Algorithm L: once the reservoir is full, the number of elements to skip before the next replacement is
+ * drawn directly, so n elements cost O(k log(n/k)) random draws instead of one per element. Skipped elements are not
+ * copied, and the iterator overload steps over them without reading them.
+ *
+ * @tparam T The element type.
+ *
+ * @code
+ * faker::helper::ReservoirSampler<std::string> lines{100};
+ *
+ * for (std::string line; std::getline(logFile, line);)
+ * {
+ *     lines.push(std::move(line));
+ * }
+ *
+ * lines.sample() // 100 lines of the file, each one equally likely
+ * @endcode
+ */
+template <class T>
+class ReservoirSampler
+{
+public:
+    /**
+     * @param sampleSize The number of elements k to keep.
+     *
+     * @throws std::invalid_argument if sampleSize is zero.
+     */
+    explicit ReservoirSampler(std::size_t sampleSize) : sampleSize_{sampleSize}
+    {
+        if (sampleSize == 0)
+        {
+            throw std::invalid_argument{"Sample size must be positive."};
+        }
+
+        sample_.reserve(sampleSize);
+    }
+
+    void push(const T& value)
+    {
+        insert(value);
+    }
+
+    void push(T&& value)
+    {
+        insert(std::move(value));
+    }
+
+    /**
+     * @brief Offers the elements of [first, last), skipped elements are advanced over in one step when the iterator
+     * allows it.
+     */
+    template <std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel>
+        requires std::constructible_from<T, std::iter_reference_t<Iterator>>
+    void push(Iterator first, Sentinel last)
+    {
+        for (; first != last && sample_.size() < sampleSize_; ++first)
+        {
+            insert(*first);
+        }
+
+        while (first != last)
+        {
+            using Difference = std::iter_difference_t<Iterator>;
+
+            const auto step = static_cast<Difference>(
+                (std::min)(skip_, static_cast<std::uint64_t>((std::numeric_limits<Difference>::max)())));
+            const auto advanced = static_cast<std::uint64_t>(step - std::ranges::advance(first, step, last));
+
+            count_ += advanced;
+            skip_ -= advanced;
+
+            if (first == last)
+            {
+                break;
+            }
+
+            if (skip_ == 0)
+            {
+                count_++;
+                replace(*first);
+                ++first;
+            }
+        }
+    }
+
+    /**
+     * @returns The sample, all elements so far while fewer than k were pushed.
+     */
+    const std::vector<T>& sample() const&
+    {
+        return sample_;
+    }
+
+    std::vector<T> sample() &&
+    {
+        return std::move(sample_);
+    }
+
+    /**
+     * @returns The number of elements pushed.
+     */
+    std::uint64_t count() const
+    {
+        return count_;
+    }
+
+private:
+    template <class Value>
+    void insert(Value&& value)
+    {
+        count_++;
+
+        if (sample_.size() < sampleSize_)
+        {
+            sample_.emplace_back(std::forward<Value>(value));
+
+            if (sample_.size() == sampleSize_)
+            {
+                nextThreshold();
+            }
+
+            return;
+        }
+
+        if (skip_ != 0)
+        {
+            skip_--;
+
+            return;
+        }
+
+        replace(std::forward<Value>(value));
+    }
+
+    template <class Value>
+    void replace(Value&& value)
+    {
+        sample_[random::UniformBound::draw(random::engine(), sampleSize_ - 1)] = T(std::forward<Value>(value));
+
+        nextThreshold();
+    }
+
+    // w is the largest of k uniform keys, the gap to the next key below it is geometric.
+    void nextThreshold()
+    {
+        threshold_ *= std::exp(std::log(detail::positiveUnitDraw()) / static_cast<double>(sampleSize_));
+
+        const auto skip = std::floor(std::log(detail::positiveUnitDraw()) / std::log1p(-threshold_));
+
+        skip_ = skip < 0x1p64 ? static_cast<std::uint64_t>(skip) : std::numeric_limits<std::uint64_t>::max();
+    }
+
+    std::size_t sampleSize_;
+    std::vector<T> sample_;
+    std::uint64_t count_{0};
+    std::uint64_t skip_{0};
+    double threshold_{1};
+};
+
+/**
+ * @brief Keeps a weighted random sample of k elements of a stream of unknown length, without replacement.
+ *
+ * Every element gets the key u^(1/weight) for a uniform u and the sample holds the k largest keys, which is
+ * Efraimidis and Spirakis' A-Res. Their A-ExpJ variant used here draws the total weight to skip before the next
+ * element enters the sample, so n elements cost O(k log(n/k)) random draws instead of one per element.
+ *
+ * @tparam T The element type.
+ *
+ * @code
+ * faker::helper::WeightedReservoirSampler<std::string> customers{10};
+ *
+ * for (const auto& row : cursor)
+ * {
+ *     customers.push(row.name, row.orderCount);
+ * }
+ *
+ * customers.sample() // 10 names, customers with more orders are more likely
+ * @endcode
+ */
+template <class T>
+class WeightedReservoirSampler
+{
+public:
+    /**
+     * @param sampleSize The number of elements k to keep.
+     *
+     * @throws std::invalid_argument if sampleSize is zero.
+     */
+    explicit WeightedReservoirSampler(std::size_t sampleSize) : sampleSize_{sampleSize}
+    {
+        if (sampleSize == 0)
+        {
+            throw std::invalid_argument{"Sample size must be positive."};
+        }
+
+        entries_.reserve(sampleSize);
+    }
+
+    /**
+     * @param value The element.
+     * @param weight The relative weight of the element, elements of weight 0 are never sampled.
+     *
+     * @throws std::invalid_argument if weight is negative, infinite or NaN.
+     */
+    void push(const T& value, double weight)
+    {
+        insert(value, weight);
+    }
+
+    void push(T&& value, double weight)
+    {
+        insert(std::move(value), weight);
+    }
+
+    /**
+     * @brief Offers the elements of [first, last), weight maps an element to its weight.
+     */
+    template <std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel, class Weight>
+        requires std::constructible_from<T, std::iter_reference_t<Iterator>> &&
+                 std::convertible_to<std::invoke_result_t<Weight&, std::iter_reference_t<Iterator>&>, double>
+    void push(Iterator first, Sentinel last, Weight weight)
+    {
+        for (; first != last; ++first)
+        {
+            std::iter_reference_t<Iterator> value = *first;
+
+            const auto elementWeight = static_cast<double>(std::invoke(weight, value));
+
+            insert(std::forward<std::iter_reference_t<Iterator>>(value), elementWeight);
+        }
+    }
+
+    /**
+     * @returns The sampled elements in no particular order.
+     */
+    std::vector<T> sample() const&
+    {
+        std::vector<T> sample;
+
+        sample.reserve(entries_.size());
+
+        for (const auto& entry : entries_)
+        {
+            sample.push_back(entry.value);
+        }
+
+        return sample;
+    }
+
+    std::vector<T> sample() &&
+    {
+        std::vector<T> sample;
+
+        sample.reserve(entries_.size());
+
+        for (auto& entry : entries_)
+        {
+            sample.push_back(std::move(entry.value));
+        }
+
+        return sample;
+    }
+
+    /**
+     * @returns The number of elements pushed.
+     */
+    std::uint64_t count() const
+    {
+        return count_;
+    }
+
+private:
+    struct Entry
+    {
+        // log(u^(1/weight)), compared in log space so small weights do not round keys to 0.
+        double logKey;
+        T value;
+    };
+
+    // Orders the entries into a min-heap of keys.
+    static bool largerKey(const Entry& left, const Entry& right)
+    {
+        return left.logKey > right.logKey;
+    }
+
+    template <class Value>
+    void insert(Value&& value, double weight)
+    {
+        if (!(weight >= 0) || std::isinf(weight))
+        {
+            throw std::invalid_argument{"Weight must be a finite non-negative number."};
+        }
+
+        count_++;
+
+        if (weight == 0)
+        {
+            return;
+        }
+
+        if (entries_.size() < sampleSize_)
+        {
+            entries_.push_back(Entry{std::log(detail::positiveUnitDraw()) / weight, T(std::forward<Value>(value))});
+            std::ranges::push_heap(entries_, largerKey);
+
+            if (entries_.size() == sampleSize_)
+            {
+                nextSkip();
+            }
+
+            return;
+        }
+
+        skipWeight_ -= weight;
+
+        if (skipWeight_ > 0)
+        {
+            return;
+        }
+
+        // The new key is conditioned to beat the smallest one: u is uniform in (threshold^weight, 1].
+        const auto thresholdPower = std::exp(entries_.front().logKey * weight);
+        const auto u = thresholdPower + (1 - thresholdPower) * detail::positiveUnitDraw();
+
+        std::ranges::pop_heap(entries_, largerKey);
+        entries_.back() = Entry{std::log(u) / weight, T(std::forward<Value>(value))};
+        std::ranges::push_heap(entries_, largerKey);
+
+        nextSkip();
+    }
+
+    void nextSkip()
+    {
+        skipWeight_ = std::log(detail::positiveUnitDraw()) / entries_.front().logKey;
+    }
+
+    std::size_t sampleSize_;
+    std::vector<Entry> entries_;
+    std::uint64_t count_{0};
+    double skipWeight_{0};
+};
+
+/**
+ * @brief Draws a uniform sample of k elements from an input range of unknown length, see `ReservoirSampler`.
+ *
+ * @param range The elements, read in a single pass.
+ * @param sampleSize The number of elements k.
+ *
+ * @throws std::invalid_argument if sampleSize is zero.
+ *
+ * @returns k elements, or all of them if the range is shorter.
+ *
+ * @code
+ * std::istringstream words{"alpha beta gamma delta"};
+ * faker::helper::reservoirSample(std::views::istream<std::string>(words), 2) // {"delta", "beta"}
+ * @endcode
+ */
+template <std::ranges::input_range Range>
+std::vector<std::ranges::range_value_t<Range>> reservoirSample(Range&& range, std::size_t sampleSize)
+{
+    ReservoirSampler<std::ranges::range_value_t<Range>> sampler{sampleSize};
+
+    sampler.push(std::ranges::begin(range), std::ranges::end(range));
+
+    return std::move(sampler).sample();
+}
+
+/**
+ * @brief Draws a weighted sample of k elements from an input range of unknown length without replacement, see
+ * `WeightedReservoirSampler`.
+ *
+ * @param range The elements, read in a single pass.
+ * @param sampleSize The number of elements k.
+ * @param weight Maps an element to its relative weight.
+ *
+ * @throws std::invalid_argument if sampleSize is zero or a weight is negative, infinite or NaN.
+ *
+ * @returns k elements in no particular order, or all elements of positive weight if fewer.
+ *
+ * @code
+ * const std::vector<std::pair<std::string, int>> visits{{"home", 90}, {"blog", 9}, {"about", 1}};
+ * faker::helper::weightedReservoirSample(visits, 1, [](const auto& page) { return page.second; }) // {{"home", 90}}
+ * @endcode
+ */
+template <std::ranges::input_range Range, class Weight>
+std::vector<std::ranges::range_value_t<Range>> weightedReservoirSample(Range&& range, std::size_t sampleSize,
+                                                                       Weight weight)
+{
+    WeightedReservoirSampler<std::ranges::range_value_t<Range>> sampler{sampleSize};
+
+    sampler.push(std::ranges::begin(range), std::ranges::end(range), std::move(weight));
+
+    return std::move(sampler).sample();
+}
+
+namespace detail
+{
+/**
+ * @brief Runs task(0), ..., task(taskCount - 1) on up to threadCount threads, 0 uses one per hardware thread.
+ *
+ * @throws The first exception thrown by a task, once all threads finished. Tasks not yet started are skipped.
+ */
+FAKER_CXX_EXPORT void parallelFor(std::size_t taskCount, unsigned threadCount,
+                                  const std::function<void(std::size_t)>& task);
+
+// An engine for one task of a keyed parallel job, the task number is hashed so neighbouring tasks do not start from
+// overlapping splitmix sequences.
+inline random::Xoshiro256StarStar taskEngine(std::uint64_t key, std::uint64_t task)
+{
+    return random::Xoshiro256StarStar{key ^ random::detail::splitMix64(task)};
+}
+
+template <std::random_access_iterator Iterator, class Generator>
+void fisherYates(Iterator first, std::size_t size, Generator& generator)
+{
+    using Difference = std::iter_difference_t<Iterator>;
+
+    for (auto i = size; i > 1; i--)
+    {
+        const auto j = random::UniformBound::draw(generator, i - 1);
+
+        std::ranges::iter_swap(first + static_cast<Difference>(i - 1), first + static_cast<Difference>(j));
+    }
+}
+}
+
+struct ShufflePolicy
+{
+    // Threads shuffling the range, 0 uses one per hardware thread. The result does not depend on it.
+    unsigned threadCount = 0;
+};
+
+/**
+ * @brief Shuffles a range in parallel, every permutation is equally likely.
+ *
+ * Large ranges are shuffled by a bucketed scatter: chunks of the range send every element to a random bucket, then
+ * every bucket is shuffled on its own, which keeps the random accesses within the cache. Buckets hold 2^16 elements
+ * on average, ranges above 2^28 elements are split into 4096 buckets of size / 4096 elements on average.
+ * Chunks and buckets draw from their own engines keyed by one word of the calling thread's engine, so a seeded
+ * shuffle gives the same order for any thread count. The scatter needs a buffer as large as the range.
+ *
+ * Ranges below 2^18 elements, and ranges whose elements may throw on move assignment, are shuffled in place on the
+ * calling thread, since a throwing move would lose the elements already scattered.
+ *
+ * @param range The elements to shuffle.
+ * @param policy The number of threads.
+ *
+ * @code
+ * std::vector<std::uint64_t> rowIndices(500'000'000);
+ * std::iota(rowIndices.begin(), rowIndices.end(), 0);
+ * faker::helper::shuffle(rowIndices) // rowIndices = {318220045, 7716, 490012387, ...}
+ * @endcode
+ */
+template <std::ranges::random_access_range Range>
+    requires std::ranges::sized_range<Range> && std::permutable<std::ranges::iterator_t<Range>> &&
+             std::default_initializable<std::ranges::range_value_t<Range>>
+void shuffle(Range&& range, const ShufflePolicy& policy = {})
+{
+    using Value = std::ranges::range_value_t<Range>;
+    using Difference = std::ranges::range_difference_t<Range>;
+
+    constexpr std::size_t sequentialLimit = std::size_t{1} << 18;
+    constexpr std::size_t chunkSize = std::size_t{1} << 20;
+    constexpr std::size_t bucketSize = std::size_t{1} << 16;
+    // Bounds the number of write streams of the scatter.
+    constexpr std::size_t maxBucketCount = 4096;
+
+    const auto first = std::ranges::begin(range);
+    const auto size = static_cast<std::size_t>(std::ranges::size(range));
+    const auto key = random::engine()();
+
+    if (size < sequentialLimit || !std::is_nothrow_move_assignable_v<Value>)
+    {
+        auto generator = detail::taskEngine(key, 0);
+
+        detail::fisherYates(first, size, generator);
+
+        return;
+    }
+
+    const auto chunkCount = (size + chunkSize - 1) / chunkSize;
+    const auto bucketCount = (std::min)((size + bucketSize - 1) / bucketSize, maxBucketCount);
+
+    // Element count of every chunk and bucket pair, turned into the next write position of the pair.
+    std::vector<std::size_t> positions(chunkCount * bucketCount);
+
+    detail::parallelFor(chunkCount, policy.threadCount,
+                        [&](std::size_t chunk)
+                        {
+                            auto generator = detail::taskEngine(key, chunk);
+
+                            auto* counts = positions.data() + chunk * bucketCount;
+
+                            for (auto i = chunk * chunkSize; i < (std::min)(size, (chunk + 1) * chunkSize); i++)
+                            {
+                                counts[random::UniformBound::draw(generator, bucketCount - 1)]++;
+                            }
+                        });
+
+    // Buckets are laid out one after another, each holding its elements in chunk order.
+    std::vector<std::size_t> bucketStarts(bucketCount + 1);
+    std::size_t position = 0;
+
+    for (std::size_t bucket = 0; bucket < bucketCount; bucket++)
+    {
+        bucketStarts[bucket] = position;
+
+        for (std::size_t chunk = 0; chunk < chunkCount; chunk++)
+        {
+            position += std::exchange(positions[chunk * bucketCount + bucket], position);
+        }
+    }
+
+    bucketStarts[bucketCount] = size;
+
+    const auto scattered = std::make_unique_for_overwrite<Value[]>(size);
+
+    // Replays the bucket draws of the counting pass.
+    detail::parallelFor(chunkCount, policy.threadCount,
+                        [&](std::size_t chunk)
+                        {
+                            auto generator = detail::taskEngine(key, chunk);
+
+                            auto* next = positions.data() + chunk * bucketCount;
+
+                            for (auto i = chunk * chunkSize; i < (std::min)(size, (chunk + 1) * chunkSize); i++)
+                            {
+                                scattered[next[random::UniformBound::draw(generator, bucketCount - 1)]++] =
+                                    std::ranges::iter_move(first + static_cast<Difference>(i));
+                            }
+                        });
+
+    detail::parallelFor(bucketCount, policy.threadCount,
+                        [&](std::size_t bucket)
+                        {
+                            auto generator = detail::taskEngine(key, chunkCount + bucket);
+
+                            auto* bucketFirst = scattered.get() + bucketStarts[bucket];
+                            auto* bucketLast = scattered.get() + bucketStarts[bucket + 1];
+
+                            detail::fisherYates(bucketFirst, static_cast<std::size_t>(bucketLast - bucketFirst),
+                                                generator);
+
+                            std::ranges::move(bucketFirst, bucketLast,
+                                              first + static_cast<Difference>(bucketStarts[bucket]));
+                        });
+}
+}
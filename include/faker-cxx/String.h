@@ -1,11 +1,16 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <optional>
 #include <random>
 #include <set>
+#include <span>
 #include <string>
+#include <string_view>
 
 #include "faker-cxx/Export.h"
 #include "RandomGenerator.h"
@@ -78,8 +83,8 @@ FAKER_CXX_EXPORT std::string generateAtLeastString(const GuaranteeMap& guarantee
      * faker::string::uuid() // "27666229-cedb-4a45-8018-98b1e1d921e2"
      * @endcode
      */
-    template <typename T = std::mt19937>
-    std::string uuid(RandomGenerator<T> gen = RandomGenerator<std::mt19937>{})
+    template <typename T = random::Engine>
+    std::string uuid(RandomGenerator<T> gen = RandomGenerator<T>{})
     {
         static std::uniform_int_distribution<> dist(0, 15);
         static std::uniform_int_distribution<> dist2(8, 11);
@@ -167,6 +172,26 @@ FAKER_CXX_EXPORT std::string generateAtLeastString(const GuaranteeMap& guarantee
      */
     FAKER_CXX_EXPORT std::string fromCharacters(const std::string& characters, unsigned length = 1);
 
+    /**
+     * @brief Fills out with characters drawn from the given characters.
+     *
+     * @param out The characters to overwrite.
+     * @param characters The characters to draw from.
+     *
+     * @throws std::invalid_argument if characters is empty and out is not.
+     */
+    FAKER_CXX_EXPORT void fromCharacters(std::span<char> out, std::string_view characters);
+
+    /**
+     * @brief Appends length characters drawn from the given characters to out.
+     *
+     * @code
+     * std::string code{"ID-"};
+     * faker::string::fromCharacters(code, "qwerty", 5) // code == "ID-qrwqt"
+     * @endcode
+     */
+    FAKER_CXX_EXPORT void fromCharacters(std::string& out, std::string_view characters, unsigned length);
+
     /**
      * @brief Generates a string consisting of given characters.
      *
@@ -202,6 +227,27 @@ FAKER_CXX_EXPORT std::string generateAtLeastString(const GuaranteeMap& guarantee
     FAKER_CXX_EXPORT std::string alpha(unsigned length = 1, StringCasing casing = StringCasing::Mixed,
                              const std::string& excludeCharacters = "");
 
+    /**
+     * @brief Fills out with letters in the English alphabet.
+     *
+     * @param out The characters to overwrite.
+     * @param casing The casing of the characters. Defaults to `StringCasing::Mixed`.
+     * @param excludeCharacters The characters to be excluded. Defaults to ``.
+     */
+    FAKER_CXX_EXPORT void alpha(std::span<char> out, StringCasing casing = StringCasing::Mixed,
+                                const std::string& excludeCharacters = "");
+
+    /**
+     * @brief Appends length letters in the English alphabet to out, `alpha(out, n)` matches `out += alpha(n)`.
+     *
+     * @code
+     * std::string iban{"DE"};
+     * faker::string::alpha(iban, 4, StringCasing::Upper) // iban == "DEKQTX"
+     * @endcode
+     */
+    FAKER_CXX_EXPORT void alpha(std::string& out, unsigned length, StringCasing casing = StringCasing::Mixed,
+                                const std::string& excludeCharacters = "");
+
     /**
      * @brief Generates a string consisting of letters in the English alphabet.
      *
@@ -238,6 +284,23 @@ FAKER_CXX_EXPORT std::string generateAtLeastString(const GuaranteeMap& guarantee
     FAKER_CXX_EXPORT std::string alphanumeric(unsigned length = 1, StringCasing casing = StringCasing::Mixed,
                                     const std::string& excludeCharacters = "");
 
+    /**
+     * @brief Fills out with alpha characters and digits.
+     *
+     * @param out The characters to overwrite.
+     * @param casing The casing of the characters. Defaults to `StringCasing::Mixed`.
+     * @param excludeCharacters The characters to be excluded. Defaults to ``.
+     */
+    FAKER_CXX_EXPORT void alphanumeric(std::span<char> out, StringCasing casing = StringCasing::Mixed,
+                                       const std::string& excludeCharacters = "");
+
+    /**
+     * @brief Appends length alpha characters and digits to out, `alphanumeric(out, n)` matches
+     * `out += alphanumeric(n)`.
+     */
+    FAKER_CXX_EXPORT void alphanumeric(std::string& out, unsigned length, StringCasing casing = StringCasing::Mixed,
+                                       const std::string& excludeCharacters = "");
+
     /**
      * @brief Generates a string consisting of alpha characters and digits.
      *
@@ -272,6 +335,19 @@ FAKER_CXX_EXPORT std::string generateAtLeastString(const GuaranteeMap& guarantee
      */
     FAKER_CXX_EXPORT std::string numeric(unsigned length = 1, bool allowLeadingZeros = true);
 
+    /**
+     * @brief Fills out with digits.
+     *
+     * @param out The characters to overwrite.
+     * @param allowLeadingZeros Whether the first digit may be zero. Defaults to `true`.
+     */
+    FAKER_CXX_EXPORT void numeric(std::span<char> out, bool allowLeadingZeros = true);
+
+    /**
+     * @brief Appends length digits to out, `numeric(out, n)` matches `out += numeric(n)`.
+     */
+    FAKER_CXX_EXPORT void numeric(std::string& out, unsigned length, bool allowLeadingZeros = true);
+
     /**
      * @brief Generates a given length string of digits.
      *
@@ -308,6 +384,21 @@ FAKER_CXX_EXPORT std::string generateAtLeastString(const GuaranteeMap& guarantee
     FAKER_CXX_EXPORT std::string hexadecimal(unsigned length = 1, HexCasing casing = HexCasing::Lower,
                                    HexPrefix prefix = HexPrefix::ZeroX);
 
+    /**
+     * @brief Fills out with hexadecimal digits, without a prefix.
+     *
+     * @param out The characters to overwrite.
+     * @param casing Casing of the digits. Defaults to `HexCasing::Lower`.
+     */
+    FAKER_CXX_EXPORT void hexadecimal(std::span<char> out, HexCasing casing = HexCasing::Lower);
+
+    /**
+     * @brief Appends the prefix and length hexadecimal digits to out, `hexadecimal(out, n)` matches
+     * `out += hexadecimal(n)`.
+     */
+    FAKER_CXX_EXPORT void hexadecimal(std::string& out, unsigned length, HexCasing casing = HexCasing::Lower,
+                                      HexPrefix prefix = HexPrefix::ZeroX);
+
     /**
      * @brief Returns a lowercase hexadecimal number.
      *
@@ -356,6 +447,16 @@ FAKER_CXX_EXPORT std::string generateAtLeastString(const GuaranteeMap& guarantee
      */
     FAKER_CXX_EXPORT std::string binary(unsigned length = 1);
 
+    /**
+     * @brief Fills out with the digits `0` and `1`, without a prefix.
+     */
+    FAKER_CXX_EXPORT void binary(std::span<char> out);
+
+    /**
+     * @brief Appends `0b` and length binary digits to out.
+     */
+    FAKER_CXX_EXPORT void binary(std::string& out, unsigned length);
+
     /**
      * @brief Generates a binary string.
      *
@@ -383,6 +484,16 @@ FAKER_CXX_EXPORT std::string generateAtLeastString(const GuaranteeMap& guarantee
      */
     FAKER_CXX_EXPORT std::string octal(unsigned length = 1);
 
+    /**
+     * @brief Fills out with the digits `0` to `7`, without a prefix.
+     */
+    FAKER_CXX_EXPORT void octal(std::span<char> out);
+
+    /**
+     * @brief Appends `0o` and length octal digits to out.
+     */
+    FAKER_CXX_EXPORT void octal(std::string& out, unsigned length);
+
     /**
      * @brief Generates an octal string.
      *
@@ -396,4 +507,138 @@ FAKER_CXX_EXPORT std::string generateAtLeastString(const GuaranteeMap& guarantee
      * @endcode
      */
     FAKER_CXX_EXPORT std::string octal(GuaranteeMap&& guarantee, unsigned length = 1);
+
+    namespace detail
+    {
+    inline std::string_view hexPrefixText(HexPrefix prefix)
+    {
+        switch (prefix)
+        {
+        case HexPrefix::ZeroX:
+            return "0x";
+        case HexPrefix::Hash:
+            return "#";
+        default:
+            return "";
+        }
+    }
+
+    // Generates length characters into a stack buffer chunk by chunk and copies them to out, fill is told whether it
+    // writes the first chunk.
+    template <class OutputIterator, class Fill>
+    OutputIterator writeChunked(OutputIterator out, unsigned length, Fill fill)
+    {
+        std::array<char, 256> chunk;
+
+        for (unsigned written = 0; written < length;)
+        {
+            const auto count = (std::min)(length - written, static_cast<unsigned>(chunk.size()));
+            const std::span<char> part{chunk.data(), count};
+
+            fill(part, written == 0);
+
+            out = std::ranges::copy(part, std::move(out)).out;
+            written += count;
+        }
+
+        return out;
+    }
+    }
+
+    /**
+     * @brief Writes length characters drawn from the given characters through out.
+     *
+     * @returns The iterator past the last written character.
+     *
+     * @code
+     * std::vector<char> buffer;
+     * faker::string::fromCharacters(std::back_inserter(buffer), "abc", 3) // buffer == {'b', 'a', 'b'}
+     * @endcode
+     */
+    template <std::output_iterator<char> OutputIterator>
+    OutputIterator fromCharacters(OutputIterator out, std::string_view characters, unsigned length)
+    {
+        return detail::writeChunked(std::move(out), length,
+                                    [characters](std::span<char> part, bool) { fromCharacters(part, characters); });
+    }
+
+    /**
+     * @brief Writes length letters in the English alphabet through out.
+     *
+     * @returns The iterator past the last written character.
+     */
+    template <std::output_iterator<char> OutputIterator>
+    OutputIterator alpha(OutputIterator out, unsigned length, StringCasing casing = StringCasing::Mixed,
+                         const std::string& excludeCharacters = "")
+    {
+        return detail::writeChunked(std::move(out), length, [casing, &excludeCharacters](std::span<char> part, bool)
+                                    { alpha(part, casing, excludeCharacters); });
+    }
+
+    /**
+     * @brief Writes length alpha characters and digits through out.
+     *
+     * @returns The iterator past the last written character.
+     */
+    template <std::output_iterator<char> OutputIterator>
+    OutputIterator alphanumeric(OutputIterator out, unsigned length, StringCasing casing = StringCasing::Mixed,
+                                const std::string& excludeCharacters = "")
+    {
+        return detail::writeChunked(std::move(out), length, [casing, &excludeCharacters](std::span<char> part, bool)
+                                    { alphanumeric(part, casing, excludeCharacters); });
+    }
+
+    /**
+     * @brief Writes length digits through out.
+     *
+     * @returns The iterator past the last written character.
+     */
+    template <std::output_iterator<char> OutputIterator>
+    OutputIterator numeric(OutputIterator out, unsigned length, bool allowLeadingZeros = true)
+    {
+        return detail::writeChunked(std::move(out), length,
+                                    [allowLeadingZeros](std::span<char> part, bool first)
+                                    { numeric(part, allowLeadingZeros || !first); });
+    }
+
+    /**
+     * @brief Writes the prefix and length hexadecimal digits through out.
+     *
+     * @returns The iterator past the last written character.
+     */
+    template <std::output_iterator<char> OutputIterator>
+    OutputIterator hexadecimal(OutputIterator out, unsigned length, HexCasing casing = HexCasing::Lower,
+                               HexPrefix prefix = HexPrefix::ZeroX)
+    {
+        out = std::ranges::copy(detail::hexPrefixText(prefix), std::move(out)).out;
+
+        return detail::writeChunked(std::move(out), length,
+                                    [casing](std::span<char> part, bool) { hexadecimal(part, casing); });
+    }
+
+    /**
+     * @brief Writes `0b` and length binary digits through out.
+     *
+     * @returns The iterator past the last written character.
+     */
+    template <std::output_iterator<char> OutputIterator>
+    OutputIterator binary(OutputIterator out, unsigned length)
+    {
+        out = std::ranges::copy(std::string_view{"0b"}, std::move(out)).out;
+
+        return detail::writeChunked(std::move(out), length, [](std::span<char> part, bool) { binary(part); });
+    }
+
+    /**
+     * @brief Writes `0o` and length octal digits through out.
+     *
+     * @returns The iterator past the last written character.
+     */
+    template <std::output_iterator<char> OutputIterator>
+    OutputIterator octal(OutputIterator out, unsigned length)
+    {
+        out = std::ranges::copy(std::string_view{"0o"}, std::move(out)).out;
+
+        return detail::writeChunked(std::move(out), length, [](std::span<char> part, bool) { octal(part); });
+    }
 }
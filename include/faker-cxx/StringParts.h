@@ -0,0 +1,161 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "Datatype.h"
+#include "Helper.h"
+#include "Random.h"
+
+namespace faker::helper
+{
+/**
+ * @brief A callable appending generated text to an output string, the building block of the combinators below.
+ */
+template <class Part>
+concept StringPart = std::invocable<const Part&, std::string&>;
+
+/**
+ * @brief A `StringPart` or fixed text. Text is copied when given as std::string and referenced otherwise, so string
+ * views must outlive the part.
+ */
+template <class Part>
+concept StringPartLike = StringPart<Part> || std::convertible_to<const Part&, std::string_view>;
+
+namespace detail
+{
+template <StringPartLike Part>
+auto toStringPart(Part part)
+{
+    if constexpr (StringPart<Part>)
+    {
+        return part;
+    }
+    else if constexpr (std::is_same_v<Part, std::string>)
+    {
+        return [text = std::move(part)](std::string& out) { out += text; };
+    }
+    else
+    {
+        return [text = std::string_view{part}](std::string& out) { out += text; };
+    }
+}
+}
+
+/**
+ * @brief Appends the parts one after another.
+ *
+ * The combinators are plain templates, a composite generator is a single type known at compile time and writes
+ * directly into the output string without type erasure or intermediate strings.
+ *
+ * @code
+ * const auto digit = [](std::string& out) { out += faker::string::numeric(); };
+ * const auto slot = faker::helper::concat("en", faker::helper::maybe(faker::helper::concat("f", digit)), "d", digit);
+ * faker::helper::render(slot) // "enf3d7"
+ * @endcode
+ */
+template <StringPartLike... Parts>
+auto concat(Parts... parts)
+{
+    return [... parts = detail::toStringPart(std::move(parts))](std::string& out) { (parts(out), ...); };
+}
+
+/**
+ * @brief Appends the part with the given probability and nothing otherwise.
+ */
+template <StringPartLike Part>
+auto maybe(Part part, double probability = 0.5)
+{
+    return [part = detail::toStringPart(std::move(part)), probability](std::string& out)
+    {
+        if (datatype::boolean(probability))
+        {
+            part(out);
+        }
+    };
+}
+
+/**
+ * @brief Appends one of the parts, each with the same probability.
+ */
+template <StringPartLike... Parts>
+    requires(sizeof...(Parts) > 0)
+auto oneOf(Parts... parts)
+{
+    return [... parts = detail::toStringPart(std::move(parts))](std::string& out)
+    {
+        auto index = random::UniformBound::draw(random::engine(), sizeof...(Parts) - 1);
+
+        static_cast<void>(((index-- == 0 ? (parts(out), true) : false) || ...));
+    };
+}
+
+/**
+ * @brief Appends one of the parts, chosen with probability proportional to its weight.
+ *
+ * @throws std::invalid_argument if the sum of weights is zero.
+ *
+ * @code
+ * faker::helper::weightedOneOf(faker::helper::WeightedElement<const char*>{3, "eth"},
+ *                              faker::helper::WeightedElement<const char*>{1, "wlan"})
+ * @endcode
+ */
+template <StringPartLike... Parts>
+    requires(sizeof...(Parts) > 0)
+auto weightedOneOf(WeightedElement<Parts>... parts)
+{
+    const std::uint64_t sumOfWeights = (std::uint64_t{parts.weight} + ...);
+
+    if (sumOfWeights == 0)
+    {
+        throw std::invalid_argument{"Sum of weights is zero."};
+    }
+
+    return [... weights = std::uint64_t{parts.weight}, ... parts = detail::toStringPart(std::move(parts.value)),
+            bound = random::UniformBound{sumOfWeights - 1}](std::string& out)
+    {
+        auto target = bound(random::engine());
+
+        static_cast<void>(((target < weights ? (parts(out), true) : (target -= weights, false)) || ...));
+    };
+}
+
+/**
+ * @brief Appends the part count times with the separator in between.
+ */
+template <StringPartLike Part>
+auto repeat(std::size_t count, Part part, std::string_view separator = {})
+{
+    return [count, part = detail::toStringPart(std::move(part)), separator](std::string& out)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (i != 0)
+            {
+                out += separator;
+            }
+
+            part(out);
+        }
+    };
+}
+
+/**
+ * @brief Runs a part into a new string.
+ */
+template <StringPart Part>
+std::string render(const Part& part)
+{
+    std::string out;
+
+    part(out);
+
+    return out;
+}
+}
@@ -42,6 +42,8 @@ struct FAKER_CXX_EXPORT NetworkInterfaceOptions
 /**
  * @brief Returns a random file name with extension.
  *
+ * The extensions of one file name are distinct, at most as many as there are known extensions.
+ *
  * @param options An option struct.
  *
  * @returns Random file name with extension.
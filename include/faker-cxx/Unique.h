@@ -0,0 +1,337 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "faker-cxx/Export.h"
+#include "Random.h"
+
+namespace faker::helper
+{
+/**
+ * @brief A blocked Bloom filter over 64-bit hashes.
+ *
+ * All bits of one hash fall into a single 512-bit block, so a lookup touches one cache line.
+ */
+class FAKER_CXX_EXPORT BloomFilter
+{
+public:
+    /**
+     * @param expectedCount The number of hashes the filter is sized for.
+     * @param falsePositiveRate The probability that an absent hash is reported as present at expectedCount hashes.
+     *
+     * @throws std::invalid_argument if expectedCount is zero or falsePositiveRate is not in (0, 1).
+     */
+    BloomFilter(std::uint64_t expectedCount, double falsePositiveRate);
+
+    /**
+     * @brief Adds a hash.
+     *
+     * @returns false if the hash was possibly present already.
+     */
+    bool insert(std::uint64_t hash);
+
+    bool mayContain(std::uint64_t hash) const;
+
+    std::size_t memoryBytes() const;
+
+private:
+    std::vector<std::uint64_t> words_;
+    std::uint64_t blockCount_;
+    unsigned hashCount_;
+};
+
+/**
+ * @brief What `unique` does once the exact set holds `UniqueOptions::exactLimit` values.
+ */
+enum class UniqueOverflow
+{
+    // Keeps storing every value, memory grows with the number of values.
+    Exact,
+    // Moves the values to a Bloom filter. Memory stays bounded, a small fraction of new values is rejected as
+    // possible duplicates.
+    Approximate,
+};
+
+struct UniqueOptions
+{
+    std::size_t exactLimit = 1'000'000;
+    UniqueOverflow overflow = UniqueOverflow::Approximate;
+    // Size of the Bloom filter used by UniqueOverflow::Approximate.
+    std::uint64_t expectedCount = 10'000'000;
+    double falsePositiveRate = 0.001;
+    // Consecutive duplicates after which the generator is considered exhausted.
+    unsigned maxAttempts = 1000;
+};
+
+struct UniqueStats
+{
+    // Values returned.
+    std::uint64_t generated = 0;
+    // Generated values discarded as duplicates or possible duplicates.
+    std::uint64_t rejected = 0;
+    // Estimated bytes used by the exact sets and filters.
+    std::size_t memoryBytes = 0;
+    bool approximate = false;
+
+    double retryRate() const
+    {
+        const auto attempts = generated + rejected;
+
+        return attempts == 0 ? 0 : static_cast<double>(rejected) / static_cast<double>(attempts);
+    }
+};
+
+namespace detail
+{
+template <class Value>
+std::uint64_t uniqueHash(const Value& value)
+{
+    // std::hash of integers is the identity, the mix spreads it over the filter.
+    std::uint64_t state = std::hash<Value>{}(value);
+
+    return random::detail::splitMix64(state);
+}
+
+// The part of UniqueSet that does not depend on the value type: the limits, the counters and the Bloom filter taking
+// over from the exact set.
+class FAKER_CXX_EXPORT UniqueSetState
+{
+public:
+    void configure(const UniqueOptions& options, std::size_t shardCount);
+
+protected:
+    // Counts an insertion attempt and passes its result through.
+    bool count(bool inserted);
+
+    bool exceedsExactLimit(std::size_t exactCount) const;
+
+    BloomFilter& startFilter();
+
+    void addStats(UniqueStats& stats, std::size_t exactBytes) const;
+
+    std::optional<BloomFilter> filter_;
+
+private:
+    std::size_t exactLimit_{0};
+    UniqueOverflow overflow_{UniqueOverflow::Approximate};
+    std::uint64_t expectedCount_{1};
+    double falsePositiveRate_{0.001};
+    std::uint64_t generated_{0};
+    std::uint64_t rejected_{0};
+};
+
+// Values seen so far, exact up to the limit and then as configured by UniqueOverflow.
+template <class Value>
+class UniqueSet : public UniqueSetState
+{
+public:
+    bool insert(const Value& value, std::uint64_t hash)
+    {
+        return count(filter_ ? filter_->insert(hash) : insertExact(value));
+    }
+
+    void addStats(UniqueStats& stats) const
+    {
+        UniqueSetState::addStats(stats, values_.bucket_count() * sizeof(void*) +
+                                            values_.size() * (sizeof(Value) + 2 * sizeof(void*)) + valueHeapBytes_);
+    }
+
+private:
+    bool insertExact(const Value& value)
+    {
+        const auto [stored, inserted] = values_.insert(value);
+
+        if (!inserted)
+        {
+            return false;
+        }
+
+        if constexpr (std::is_same_v<Value, std::string>)
+        {
+            if (stored->capacity() > std::string{}.capacity())
+            {
+                valueHeapBytes_ += stored->capacity() + 1;
+            }
+        }
+
+        if (exceedsExactLimit(values_.size()))
+        {
+            auto& filter = startFilter();
+
+            for (const auto& seen : values_)
+            {
+                filter.insert(uniqueHash(seen));
+            }
+
+            std::unordered_set<Value>{}.swap(values_);
+            valueHeapBytes_ = 0;
+        }
+
+        return true;
+    }
+
+    std::unordered_set<Value> values_;
+    std::size_t valueHeapBytes_{0};
+};
+}
+
+/**
+ * @brief Wraps a generator so that it never returns the same value twice.
+ *
+ * Duplicates are discarded and the generator is called again. Values are stored in an exact hash set up to
+ * `UniqueOptions::exactLimit`, beyond it `UniqueOptions::overflow` decides between keeping every value and a Bloom
+ * filter of bounded size. Not thread-safe, see `ShardedUnique`.
+ *
+ * @tparam Generator A callable without arguments returning a hashable value.
+ *
+ * @code
+ * auto emails = faker::helper::unique([] { return faker::internet::email(); });
+ * emails() // "Adrienne.Lowe@gmail.com"
+ * emails.stats().retryRate() // 0.0002
+ * @endcode
+ */
+template <class Generator>
+    requires std::invocable<Generator&>
+class Unique
+{
+public:
+    using Value = std::remove_cvref_t<std::invoke_result_t<Generator&>>;
+
+    explicit Unique(Generator generator, const UniqueOptions& options = {})
+        : generator_{std::move(generator)}, maxAttempts_{options.maxAttempts}
+    {
+        values_.configure(options, 1);
+    }
+
+    /**
+     * @throws std::runtime_error if `UniqueOptions::maxAttempts` generated values in a row were duplicates.
+     */
+    Value operator()()
+    {
+        for (unsigned attempt = 0; attempt < maxAttempts_; attempt++)
+        {
+            auto value = std::invoke(generator_);
+
+            if (values_.insert(value, detail::uniqueHash(value)))
+            {
+                return value;
+            }
+        }
+
+        throw std::runtime_error{"Generator did not produce a unique value within the attempt limit."};
+    }
+
+    UniqueStats stats() const
+    {
+        UniqueStats stats;
+
+        values_.addStats(stats);
+
+        return stats;
+    }
+
+private:
+    Generator generator_;
+    unsigned maxAttempts_;
+    detail::UniqueSet<Value> values_;
+};
+
+template <class Generator>
+Unique<Generator> unique(Generator generator, const UniqueOptions& options = {})
+{
+    return Unique<Generator>{std::move(generator), options};
+}
+
+/**
+ * @brief A thread-safe `Unique`, values are spread over independently locked shards by their hash.
+ *
+ * The generator is called concurrently without locking, so it must be safe to call from many threads, which the
+ * library generators are. Limits in the options apply to all shards together.
+ *
+ * @tparam Generator A callable without arguments returning a hashable value.
+ */
+template <class Generator>
+    requires std::invocable<const Generator&>
+class ShardedUnique
+{
+public:
+    using Value = std::remove_cvref_t<std::invoke_result_t<const Generator&>>;
+
+    explicit ShardedUnique(Generator generator, const UniqueOptions& options = {}, std::size_t shardCount = 64)
+        : generator_{std::move(generator)}, maxAttempts_{options.maxAttempts}, shards_(shardCount)
+    {
+        if (shardCount == 0)
+        {
+            throw std::invalid_argument{"Shard count must be greater than zero."};
+        }
+
+        for (auto& shard : shards_)
+        {
+            shard.values.configure(options, shardCount);
+        }
+    }
+
+    /**
+     * @throws std::runtime_error if `UniqueOptions::maxAttempts` generated values in a row were duplicates.
+     */
+    Value operator()()
+    {
+        for (unsigned attempt = 0; attempt < maxAttempts_; attempt++)
+        {
+            auto value = std::invoke(std::as_const(generator_));
+
+            const auto hash = detail::uniqueHash(value);
+
+            // The high bits pick the shard, the filter inside a shard uses the full hash.
+            std::uint64_t low;
+
+            auto& shard = shards_[static_cast<std::size_t>(random::detail::multiplyHigh(hash, shards_.size(), low))];
+
+            std::lock_guard lock{shard.mutex};
+
+            if (shard.values.insert(value, hash))
+            {
+                return value;
+            }
+        }
+
+        throw std::runtime_error{"Generator did not produce a unique value within the attempt limit."};
+    }
+
+    UniqueStats stats() const
+    {
+        UniqueStats stats;
+
+        for (auto& shard : shards_)
+        {
+            std::lock_guard lock{shard.mutex};
+
+            shard.values.addStats(stats);
+        }
+
+        return stats;
+    }
+
+private:
+    struct alignas(64) Shard
+    {
+        mutable std::mutex mutex;
+        detail::UniqueSet<Value> values;
+    };
+
+    Generator generator_;
+    unsigned maxAttempts_;
+    std::vector<Shard> shards_;
+};
+}
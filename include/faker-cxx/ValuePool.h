@@ -0,0 +1,123 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "faker-cxx/Export.h"
+#include "Number.h"
+#include "Random.h"
+
+namespace faker::helper
+{
+/**
+ * @brief How `ValuePool` picks the value of a draw.
+ */
+enum class PoolDistribution
+{
+    Uniform,
+    // The first values of the pool are drawn the most, see `number::ZipfSampler`.
+    Zipf,
+};
+
+struct ValuePoolOptions
+{
+    // Threads filling the pool, 0 uses one per hardware thread.
+    unsigned threadCount = 0;
+    PoolDistribution distribution = PoolDistribution::Uniform;
+    double zipfExponent = 1.;
+    // Draws after which the pool is filled with new values, 0 never refreshes.
+    std::uint64_t refreshAfterDraws = 0;
+    // Age after which the pool is filled with new values, checked once every 1024 draws. Zero never refreshes.
+    std::chrono::steady_clock::duration refreshInterval{};
+};
+
+/**
+ * @brief Serves draws from values generated once, for generators too slow to call per value in load tests.
+ *
+ * The pool calls the generator for every value in parallel and packs the results back to back into one arena, so a
+ * draw costs a random index and two offset reads. Every value is generated in a `random::RecordScope` keyed by a word
+ * of the calling thread's engine and its index, so a seeded pool holds the same values for any thread count.
+ *
+ * Copies share the arena and draws only read it, so give every thread its own copy. Refreshing fills a new arena for
+ * the refreshing copy only, views it returned earlier stay valid as long as another copy still holds the old arena.
+ *
+ * @tparam Generator A callable without arguments returning text, called concurrently while filling.
+ *
+ * @code
+ * faker::helper::ValuePool addresses{100'000, [] { return faker::location::streetAddress(); }};
+ * addresses() // "4017 Runolfsdottir Mission"
+ *
+ * faker::helper::ValuePool popularNames{10'000, [] { return faker::person::fullName(); },
+ *                                       {.distribution = faker::helper::PoolDistribution::Zipf}};
+ * @endcode
+ */
+class FAKER_CXX_EXPORT ValuePool
+{
+public:
+    /**
+     * @param size The number of values.
+     * @param generator Produces the values.
+     * @param options The fill, draw and refresh policy.
+     *
+     * @throws std::invalid_argument if size is zero, or if the Zipf exponent is negative.
+     */
+    template <class Generator>
+        requires requires(Generator& generator, std::string& out) { out.append(generator()); }
+    ValuePool(std::size_t size, Generator generator, const ValuePoolOptions& options = {})
+        : ValuePool{size, [generator = std::move(generator)](std::string& out) mutable { out.append(generator()); },
+                    options}
+    {
+    }
+
+    /**
+     * @brief Draws a value with the configured distribution, refreshing the pool first when it is due.
+     */
+    std::string_view operator()();
+
+    /**
+     * @returns The value at index, smaller than `size()`.
+     */
+    std::string_view operator[](std::size_t index) const;
+
+    /**
+     * @brief Fills the pool with new values.
+     */
+    void refresh();
+
+    std::size_t size() const;
+
+    /**
+     * @returns The bytes of text in the arena.
+     */
+    std::size_t arenaBytes() const;
+
+private:
+    struct Arena
+    {
+        std::string text;
+        // Value i spans [offsets[i], offsets[i + 1]) of text.
+        std::vector<std::size_t> offsets;
+    };
+
+    ValuePool(std::size_t size, std::function<void(std::string&)> append, const ValuePoolOptions& options);
+
+    static std::shared_ptr<const Arena> fill(std::size_t size, const std::function<void(std::string&)>& append,
+                                             unsigned threadCount);
+
+    std::function<void(std::string&)> append_;
+    ValuePoolOptions options_;
+    std::shared_ptr<const Arena> arena_;
+    random::UniformBound uniformIndex_;
+    std::optional<number::ZipfSampler> zipfRank_;
+    std::uint64_t drawsSinceRefresh_{0};
+    std::chrono::steady_clock::time_point filledAt_;
+};
+}
@@ -22,6 +22,27 @@ namespace faker::word
  */
 FAKER_CXX_EXPORT std::string_view sample(std::optional<unsigned> length = std::nullopt);
 
+/**
+ * @brief Returns a random word, with some words far more frequent than others.
+ *
+ * Words are drawn with `helper::zipfArrayElement` over the dictionary ranked by how common each word is in English,
+ * so "the" is the most frequent word and the first common word of the requested length is the most frequent one.
+ *
+ * @param length The expected length of the word, or std::nullopt for any length.
+ * If no word with given length will be found, it will return a random word.
+ * @param skew The Zipf exponent, 0 gives the same distribution as `sample(length)`.
+ *
+ * @throws std::invalid_argument if skew is negative.
+ *
+ * @returns Random sample word.
+ *
+ * @code
+ * faker::word::sample(std::nullopt, 1.1) // "the"
+ * faker::word::sample(5, 1.1) // "about"
+ * @endcode
+ */
+FAKER_CXX_EXPORT std::string_view sample(std::optional<unsigned> length, double skew);
+
 /**
  * @brief Returns a string containing a number of space separated random words.
  *
@@ -1,15 +1,14 @@
 #pragma once
 
 #include <algorithm>
-#include <functional>
 #include <random>
 #include <set>
 #include <stdexcept>
 #include <string>
 
-#include "faker-cxx/Datatype.h"
 #include "faker-cxx/Export.h"
 #include "faker-cxx/Helper.h"
+#include "faker-cxx/Random.h"
 
 namespace faker::helper
 {
@@ -23,9 +22,7 @@ static T setElement(const std::set<T>& data)
 
     T item;
 
-    static std::mt19937 pseudoRandomGenerator(static_cast<unsigned long>(std::random_device{}()));
-
-    std::sample(data.begin(), data.end(), &item, 1, pseudoRandomGenerator);
+    std::sample(data.begin(), data.end(), &item, 1, random::engine());
 
     return item;
 }
@@ -50,16 +47,6 @@ static T::key_type objectKey(const T& object)
     return arrayElement<typename T::key_type>(keys);
 }
 
-template <typename TResult>
-static TResult maybe(std::function<TResult()> callback, double probability = 0.5)
-{
-    if (datatype::boolean(probability))
-    {
-        return callback();
-    }
-    return TResult();
-}
-
 template <typename T, std::size_t N>
 static std::vector<T> toVector(const std::array<T, N>& arr)
 {
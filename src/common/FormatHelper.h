@@ -1,9 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include "faker-cxx/types/Precision.h"
 #include "faker-cxx/Export.h"
@@ -41,4 +47,143 @@ namespace faker::common
     FAKER_CXX_EXPORT std::string
     fillTokenValues(const std::string& format,
                     std::unordered_map<std::string_view, std::function<std::string_view()>> tokenValueGenerators);
+
+    /**
+     * @brief Binds a `{token}` name to a function appending its value to the output.
+     */
+    template <class Context>
+    struct TokenSlot
+    {
+        std::string_view token;
+        void (*append)(const Context& context, std::string& out);
+    };
+
+    /**
+     * @brief A format with `{token}` placeholders, parsed once into literal text and bound slots.
+     *
+     * Accepts the same syntax as `fillTokenValues`, rendering appends every segment to a single output string.
+     *
+     * @tparam Context The data passed to every slot function, e.g. the country of the generated value.
+     */
+    template <class Context>
+    class TokenTemplate
+    {
+    public:
+        /**
+         * @throws std::runtime_error if a token of format has no slot.
+         */
+        TokenTemplate(std::string_view format, std::span<const TokenSlot<Context>> slots)
+        {
+            std::size_t tokenStart = 0;
+            bool inToken = false;
+
+            for (std::size_t i = 0; i < format.size(); i++)
+            {
+                if (format[i] == '{')
+                {
+                    tokenStart = i + 1;
+                    inToken = true;
+                }
+                else if (format[i] == '}' && inToken && tokenStart < i)
+                {
+                    const auto token = format.substr(tokenStart, i - tokenStart);
+
+                    const auto slot = std::ranges::find(slots, token, &TokenSlot<Context>::token);
+
+                    if (slot == slots.end())
+                    {
+                        throw std::runtime_error{common::format("Generator not found for token {}.", token)};
+                    }
+
+                    segments_.push_back({0, 0, slot->append});
+
+                    inToken = false;
+                }
+                else if (!inToken)
+                {
+                    if (segments_.empty() || segments_.back().append != nullptr)
+                    {
+                        segments_.push_back({text_.size(), 0, nullptr});
+                    }
+
+                    text_ += format[i];
+                    segments_.back().length++;
+                }
+            }
+        }
+
+        void render(const Context& context, std::string& out) const
+        {
+            for (const auto& segment : segments_)
+            {
+                if (segment.append != nullptr)
+                {
+                    segment.append(context, out);
+                }
+                else
+                {
+                    out.append(text_, segment.offset, segment.length);
+                }
+            }
+        }
+
+        std::string render(const Context& context) const
+        {
+            std::string out;
+
+            render(context, out);
+
+            return out;
+        }
+
+    private:
+        // A slot when append is set, literal text from text_ otherwise.
+        struct Segment
+        {
+            std::size_t offset;
+            std::size_t length;
+            void (*append)(const Context& context, std::string& out);
+        };
+
+        std::string text_;
+        std::vector<Segment> segments_;
+    };
+
+    /**
+     * @brief Parses each format on its first use with a fixed set of slots and keeps the result.
+     *
+     * Not synchronized, call sites keep one cache per thread.
+     */
+    template <class Context>
+    class TokenTemplateCache
+    {
+    public:
+        TokenTemplateCache(std::initializer_list<TokenSlot<Context>> slots) : slots_{slots} {}
+
+        const TokenTemplate<Context>& operator[](std::string_view format)
+        {
+            auto parsed = templates_.find(format);
+
+            if (parsed == templates_.end())
+            {
+                parsed = templates_.try_emplace(std::string{format}, format, slots_).first;
+            }
+
+            return parsed->second;
+        }
+
+    private:
+        struct FormatHash
+        {
+            using is_transparent = void;
+
+            std::size_t operator()(std::string_view format) const
+            {
+                return std::hash<std::string_view>{}(format);
+            }
+        };
+
+        std::vector<TokenSlot<Context>> slots_;
+        std::unordered_map<std::string, TokenTemplate<Context>, FormatHash, std::equal_to<>> templates_;
+    };
 }
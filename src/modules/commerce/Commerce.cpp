@@ -35,6 +35,11 @@ std::string_view productName()
     return helper::arrayElement(productNames);
 }
 
+std::string_view productName(double skew)
+{
+    return helper::zipfArrayElement(productNames, skew);
+}
+
 std::string productFullName()
 {
     return common::format("{} {} {}", productAdjective(), productMaterial(), productName());
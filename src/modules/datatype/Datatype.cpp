@@ -1,35 +1,109 @@
 #include "faker-cxx/Datatype.h"
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
 
-#include "faker-cxx/Number.h"
+#include "faker-cxx/Random.h"
 
 namespace faker::datatype
 {
+namespace
+{
+// Resolution of the probability used by booleans, which compares 32-bit draws with the threshold.
+constexpr int maskThresholdBits = 32;
+}
+
 bool boolean()
 {
-    return number::decimal<float>(0.f, 1.f) > 0.5f;
+    return random::entropyPool().boolean();
 }
 
 bool boolean(double probability)
 {
-    if (probability != nan(""))
+    if (std::isnan(probability))
     {
-        double prob = probability;
+        return boolean();
+    }
 
-        if (prob <= 0.)
-        {
-            return false;
-        }
+    if (probability <= 0.)
+    {
+        return false;
+    }
+
+    if (probability >= 1.)
+    {
+        return true;
+    }
+
+    // Exact for every double below 1, the product is at most 2^64 - 2^11.
+    const auto threshold = static_cast<std::uint64_t>(std::ldexp(probability, 64));
+
+    return random::engine()() < threshold;
+}
+
+void booleans(std::span<std::uint64_t> mask, double probability)
+{
+    if (std::isnan(probability))
+    {
+        probability = 0.5;
+    }
+
+    const auto threshold = static_cast<std::uint64_t>(
+        std::llround(std::ldexp(std::clamp(probability, 0., 1.), maskThresholdBits)));
 
-        if (prob >= 1.)
+    if (threshold == 0 || threshold == std::uint64_t{1} << maskThresholdBits)
+    {
+        std::ranges::fill(mask, threshold == 0 ? 0 : (std::numeric_limits<std::uint64_t>::max)());
+
+        return;
+    }
+
+    // Bit i of a mask word is set when the 32-bit number u_i < threshold. The 64 numbers of a mask word are stored
+    // bit-sliced, one random word per bit plane, and compared from the least significant plane up. Planes below the
+    // lowest set bit of the threshold cannot change the result and are skipped, so p = 0.5 takes a single word.
+    const auto lowestPlane = std::countr_zero(threshold);
+    const auto planeCount = static_cast<std::size_t>(maskThresholdBits - lowestPlane);
+
+    if (planeCount == 1)
+    {
+        random::fill(mask);
+
+        return;
+    }
+
+    std::array<std::uint64_t, random::WordBuffer::capacity> planes;
+
+    const auto maskWordsPerBlock = planes.size() / planeCount;
+
+    while (!mask.empty())
+    {
+        const auto maskWordCount = (std::min)(mask.size(), maskWordsPerBlock);
+
+        random::fill(std::span<std::uint64_t>{planes.data(), maskWordCount * planeCount});
+
+        auto plane = planes.cbegin();
+
+        for (auto& maskWord : mask.first(maskWordCount))
         {
-            return true;
+            std::uint64_t less = 0;
+
+            for (auto bit = lowestPlane; bit < maskThresholdBits; bit++)
+            {
+                less = ((threshold >> bit) & 1) != 0 ? (less | *plane) : (less & *plane);
+
+                ++plane;
+            }
+
+            maskWord = less;
         }
 
-        return number::decimal(0., 1.) < prob;
+        mask = mask.subspan(maskWordCount);
     }
-
-    return number::decimal(0., 1.) < 0.5;
 }
 }
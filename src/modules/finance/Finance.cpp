@@ -1,6 +1,8 @@
 #include "faker-cxx/Finance.h"
 
+#include <cstdint>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -64,6 +66,9 @@ std::string iban(std::optional<IbanCountry> country)
 
     std::string iban{countryCode};
 
+    // IBANs are at most 34 characters long, so every field is appended in place without reallocating.
+    iban.reserve(34);
+
     for (size_t i = 1; i < ibanFormat.size(); i++)
     {
         const auto& ibanFormatEntry = ibanFormat[i];
@@ -74,15 +79,15 @@ std::string iban(std::optional<IbanCountry> country)
 
         if (ibanFormatEntryDataType == 'a')
         {
-            iban += string::alpha(static_cast<unsigned>(ibanFormatEntryDataLength), string::StringCasing::Upper);
+            string::alpha(iban, static_cast<unsigned>(ibanFormatEntryDataLength), string::StringCasing::Upper);
         }
         else if (ibanFormatEntryDataType == 'c')
         {
-            iban += string::alphanumeric(static_cast<unsigned>(ibanFormatEntryDataLength), string::StringCasing::Upper);
+            string::alphanumeric(iban, static_cast<unsigned>(ibanFormatEntryDataLength), string::StringCasing::Upper);
         }
         else if (ibanFormatEntryDataType == 'n')
         {
-            iban += string::numeric(static_cast<unsigned>(ibanFormatEntryDataLength));
+            string::numeric(iban, static_cast<unsigned>(ibanFormatEntryDataLength));
         }
     }
 
@@ -101,6 +106,34 @@ std::string accountNumber(unsigned int length)
     return string::numeric(length, true);
 }
 
+std::string accountNumber(unsigned int length, std::uint64_t index, std::uint64_t key)
+{
+    if (length == 0 || length > 19)
+    {
+        throw std::invalid_argument("Account number length must be between 1 and 19.");
+    }
+
+    std::uint64_t accountNumberCount = 1;
+
+    for (unsigned i = 0; i < length; i++)
+    {
+        accountNumberCount *= 10;
+    }
+
+    if (index >= accountNumberCount)
+    {
+        throw std::invalid_argument("Index is outside of the account number range.");
+    }
+
+    const number::Permutation accountNumbers{0, accountNumberCount - 1, key};
+
+    auto digits = std::to_string(accountNumbers(index));
+
+    digits.insert(0, length - digits.size(), '0');
+
+    return digits;
+}
+
 std::string pin(unsigned int length)
 {
     return string::numeric(length, true);
@@ -1,42 +1,420 @@
 
 #include <algorithm>
-#include <random>
-#include <regex>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "../../common/LuhnCheck.h"
 #include "../../common/StringHelper.h"
 #include "../../common/AlgoHelper.h"
+#include "faker-cxx/Helper.h"
 #include "faker-cxx/Number.h"
+#include "faker-cxx/Random.h"
 
 namespace faker::helper
 {
-std::string shuffleString(std::string data)
+namespace
+{
+// Cuts decimal digits out of wide draws: a word below 18 * 10^18 yields 18 uniform digits, the rare larger words are
+// rejected. Digits between 2 and 9 take 3 bits each from a separate word.
+template <class Generator>
+class DigitSource
+{
+public:
+    explicit DigitSource(Generator& generator) : generator_{generator} {}
+
+    char digit()
+    {
+        if (remainingDigits_ == 0)
+        {
+            std::uint64_t word;
+
+            do
+            {
+                word = generator_();
+            } while (word >= digitWordLimit);
+
+            digits_ = word % digitsPerWordModulus;
+            remainingDigits_ = digitsPerWord;
+        }
+
+        const auto value = digits_ % 10;
+
+        digits_ /= 10;
+        remainingDigits_--;
+
+        return static_cast<char>('0' + value);
+    }
+
+    char nonZeroDigit()
+    {
+        if (remainingBits_ < 3)
+        {
+            bits_ = generator_();
+            remainingBits_ = 64;
+        }
+
+        const auto value = bits_ & 7;
+
+        bits_ >>= 3;
+        remainingBits_ -= 3;
+
+        return static_cast<char>('2' + value);
+    }
+
+private:
+    static constexpr unsigned digitsPerWord = 18;
+    static constexpr std::uint64_t digitsPerWordModulus = 1'000'000'000'000'000'000;
+    static constexpr std::uint64_t digitWordLimit = 18 * digitsPerWordModulus;
+
+    Generator& generator_;
+    std::uint64_t digits_{0};
+    unsigned remainingDigits_{0};
+    std::uint64_t bits_{0};
+    unsigned remainingBits_{0};
+};
+
+// A regexpStyleStringParse pattern parsed into literal text, character classes and number ranges, each emitted a fixed
+// or random number of times.
+class PatternProgram
 {
-    static std::mt19937 pseudoRandomGenerator(std::random_device{}());
+public:
+    explicit PatternProgram(std::string_view pattern)
+    {
+        std::size_t position = 0;
+
+        while (position < pattern.size())
+        {
+            if (pattern[position] == '[' && parseBracket(pattern, position))
+            {
+                continue;
+            }
+
+            if (pattern[position] == '{' && parseQuantifier(pattern, position))
+            {
+                continue;
+            }
+
+            appendLiteral(pattern[position]);
+
+            position++;
+        }
+
+        for (const auto& instruction : instructions_)
+        {
+            std::uint64_t atomLength = 1;
+
+            if (instruction.opcode == Opcode::Text)
+            {
+                atomLength = instruction.length;
+            }
+            else if (instruction.opcode == Opcode::NumberRange)
+            {
+                atomLength = digitCount(instruction.maximum);
+            }
+
+            maxLength_ += atomLength * instruction.maxRepeat;
+        }
+    }
+
+    void run(std::string& out) const
+    {
+        // Very long repetitions grow the string as they go instead of reserving their upper bound.
+        constexpr std::uint64_t reserveLimit = 4096;
+
+        out.reserve(out.size() + static_cast<std::size_t>((std::min)(maxLength_, reserveLimit)));
+
+        auto& generator = random::engine();
+        auto& pool = random::entropyPool();
+
+        for (const auto& instruction : instructions_)
+        {
+            const auto repetitions =
+                instruction.minRepeat == instruction.maxRepeat
+                    ? instruction.minRepeat
+                    : instruction.minRepeat +
+                          random::UniformBound::draw(generator, instruction.maxRepeat - instruction.minRepeat);
+
+            for (std::uint64_t i = 0; i < repetitions; i++)
+            {
+                switch (instruction.opcode)
+                {
+                case Opcode::Text:
+                    out.append(characters_, instruction.offset, instruction.length);
+                    break;
+                case Opcode::CharacterClass:
+                    out += characters_[instruction.offset + pool.uniform(instruction.length)];
+                    break;
+                case Opcode::NumberRange:
+                {
+                    const auto value =
+                        instruction.minimum +
+                        random::UniformBound::draw(generator, instruction.maximum - instruction.minimum);
+
+                    std::array<char, 20> digits;
+
+                    const auto end = std::to_chars(digits.data(), digits.data() + digits.size(), value).ptr;
 
-    std::shuffle(data.begin(), data.end(), pseudoRandomGenerator);
+                    out.append(digits.data(), end);
+                    break;
+                }
+                }
+            }
+        }
+    }
+
+private:
+    enum class Opcode : std::uint8_t
+    {
+        Text,
+        CharacterClass,
+        NumberRange,
+    };
+
+    struct Instruction
+    {
+        Opcode opcode;
+        // Characters of Text and CharacterClass in characters_.
+        std::size_t offset{0};
+        std::size_t length{0};
+        // Bounds of NumberRange.
+        std::uint64_t minimum{0};
+        std::uint64_t maximum{0};
+        std::uint64_t minRepeat{1};
+        std::uint64_t maxRepeat{1};
+        bool quantified{false};
+    };
+
+    static std::uint64_t digitCount(std::uint64_t value)
+    {
+        std::uint64_t count = 1;
+
+        while (value >= 10)
+        {
+            value /= 10;
+            count++;
+        }
+
+        return count;
+    }
+
+    template <class Integer>
+    static bool parseInteger(std::string_view text, Integer& value)
+    {
+        if (text.empty())
+        {
+            return false;
+        }
+
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+        return error == std::errc{} && end == text.data() + text.size();
+    }
+
+    // Bounds are swapped when given in descending order.
+    template <class Integer>
+    static bool parseBounds(std::string_view text, char separator, Integer& minimum, Integer& maximum)
+    {
+        const auto separatorPosition = text.find(separator);
+
+        if (separatorPosition == std::string_view::npos ||
+            !parseInteger(text.substr(0, separatorPosition), minimum) ||
+            !parseInteger(text.substr(separatorPosition + 1), maximum))
+        {
+            return false;
+        }
+
+        if (minimum > maximum)
+        {
+            std::swap(minimum, maximum);
+        }
+
+        return true;
+    }
+
+    // `[min-max]` with decimal numbers is a number range, any other bracket is a character class of single characters
+    // and `a-z` style ranges.
+    bool parseBracket(std::string_view pattern, std::size_t& position)
+    {
+        const auto close = pattern.find(']', position + 2);
+
+        if (close == std::string_view::npos)
+        {
+            return false;
+        }
+
+        const auto body = pattern.substr(position + 1, close - position - 1);
+
+        Instruction instruction{Opcode::NumberRange};
+
+        if (!parseBounds(body, '-', instruction.minimum, instruction.maximum))
+        {
+            std::array<bool, 256> members{};
+
+            for (std::size_t i = 0; i < body.size(); i++)
+            {
+                auto first = static_cast<unsigned char>(body[i]);
+                auto last = first;
+
+                if (i + 2 < body.size() && body[i + 1] == '-')
+                {
+                    last = static_cast<unsigned char>(body[i + 2]);
+                    i += 2;
+                }
+
+                if (first > last)
+                {
+                    std::swap(first, last);
+                }
+
+                for (unsigned character = first; character <= last; character++)
+                {
+                    members[character] = true;
+                }
+            }
+
+            instruction.opcode = Opcode::CharacterClass;
+            instruction.offset = characters_.size();
+
+            for (unsigned character = 0; character < members.size(); character++)
+            {
+                if (members[character])
+                {
+                    characters_ += static_cast<char>(character);
+                }
+            }
+
+            instruction.length = characters_.size() - instruction.offset;
+        }
+
+        instructions_.push_back(instruction);
+
+        position = close + 1;
+
+        return true;
+    }
+
+    // `{n}` or `{min,max}` repeats the preceding character, class or number range.
+    bool parseQuantifier(std::string_view pattern, std::size_t& position)
+    {
+        const auto close = pattern.find('}', position + 1);
+
+        if (instructions_.empty() || instructions_.back().quantified || close == std::string_view::npos)
+        {
+            return false;
+        }
+
+        const auto body = pattern.substr(position + 1, close - position - 1);
+
+        std::uint32_t minRepeat;
+        std::uint32_t maxRepeat;
+
+        if (body.find(',') != std::string_view::npos)
+        {
+            if (!parseBounds(body, ',', minRepeat, maxRepeat))
+            {
+                return false;
+            }
+        }
+        else if (parseInteger(body, minRepeat))
+        {
+            maxRepeat = minRepeat;
+        }
+        else
+        {
+            return false;
+        }
+
+        // Literal text is merged while parsing, only its last character is repeated.
+        if (instructions_.back().opcode == Opcode::Text && instructions_.back().length > 1)
+        {
+            auto& text = instructions_.back();
+
+            text.length--;
+
+            instructions_.push_back({Opcode::Text, text.offset + text.length, 1});
+        }
+
+        auto& instruction = instructions_.back();
+
+        instruction.minRepeat = minRepeat;
+        instruction.maxRepeat = maxRepeat;
+        instruction.quantified = true;
+
+        position = close + 1;
+
+        return true;
+    }
+
+    void appendLiteral(char character)
+    {
+        if (instructions_.empty() || instructions_.back().opcode != Opcode::Text || instructions_.back().quantified)
+        {
+            instructions_.push_back({Opcode::Text, characters_.size(), 0});
+        }
+
+        characters_ += character;
+        instructions_.back().length++;
+    }
+
+    std::vector<Instruction> instructions_;
+    std::string characters_;
+    std::uint64_t maxLength_{0};
+};
+
+// Patterns come from the data tables, so each thread compiles a handful of them once. The limit only guards against
+// callers passing generated patterns.
+const PatternProgram& compiledPattern(const std::string& pattern)
+{
+    constexpr std::size_t cacheLimit = 256;
+
+    thread_local std::unordered_map<std::string, PatternProgram> cache;
+
+    if (const auto program = cache.find(pattern); program != cache.end())
+    {
+        return program->second;
+    }
+
+    if (cache.size() >= cacheLimit)
+    {
+        cache.clear();
+    }
+
+    return cache.try_emplace(pattern, pattern).first->second;
+}
+}
+
+std::string shuffleString(std::string data)
+{
+    std::shuffle(data.begin(), data.end(), random::engine());
 
     return data;
 }
 
 std::string replaceSymbolWithNumber(const std::string& str, const char& symbol)
 {
-    std::string result;
+    std::string result = str;
+
+    DigitSource digits{random::engine()};
 
-    for (const auto& ch : str)
+    for (auto& ch : result)
     {
         if (ch == symbol)
         {
-            result += std::to_string(number::integer(0, 9));
+            ch = digits.digit();
         }
         else if (ch == '!')
         {
-            result += std::to_string(number::integer(2, 9));
-        }
-        else
-        {
-            result += ch;
+            ch = digits.nonZeroDigit();
         }
     }
 
@@ -66,53 +444,79 @@ std::string replaceCreditCardSymbols(const std::string& inputString, char symbol
 
 std::string regexpStyleStringParse(const std::string& input)
 {
-    std::string data = input;
-    // Deal with range repeat `{min,max}`
-    const std::regex RANGE_REP_REG(R"((.)\{(\d+),(\d+)\})");
-    const std::regex REP_REG(R"((.)\{(\d+)\})");
-    const std::regex RANGE_REG(R"(\[(\d+)-(\d+)\])");
-    std::smatch token;
+    std::string result;
 
-    while (std::regex_search(data, token, RANGE_REP_REG))
+    compiledPattern(input).run(result);
+
+    return result;
+}
+
+DigitTemplate::DigitTemplate(std::string_view mask, char symbol) : mask_{mask}
+{
+    for (std::size_t i = 0; i < mask_.size(); i++)
     {
-        int min = std::stoi(token[2]);
-        int max = std::stoi(token[3]);
-        if (min > max)
+        if (mask_[i] == symbol)
         {
-            std::swap(min, max);
+            digitPositions_.push_back(i);
         }
+        else if (mask_[i] == '!')
+        {
+            nonZeroDigitPositions_.push_back(i);
+        }
+    }
+}
+
+std::string DigitTemplate::operator()() const
+{
+    std::string result = mask_;
 
-        int repetitions = number::integer(min, max);
-        data = data.substr(0, static_cast<unsigned long>(token.position())) +
-               common::repeat(token[1], repetitions) +
-               data.substr(static_cast<unsigned long>(token.position() + token.length()));
+    fill(result, random::engine());
+
+    return result;
+}
+
+void DigitTemplate::render(std::span<char> out) const
+{
+    if (mask_.empty() ? !out.empty() : out.size() % mask_.size() != 0)
+    {
+        throw std::invalid_argument{"Output size is not a multiple of the mask size."};
     }
 
-    // Deal with repeat `{num}`
-    while (std::regex_search(data, token, REP_REG))
+    if (mask_.empty())
     {
-        int repetitions = std::stoi(token[2]);
-        data = data.substr(0, static_cast<unsigned long>(token.position())) +
-               common::repeat(token[1], repetitions) +
-               data.substr(static_cast<unsigned long>(token.position() + token.length()));
+        return;
     }
 
-    // Deal with range `[min-max]` (only works with numbers for now)
-    // TODO: implement for letters e.g. [0-9a-zA-Z] etc.
-    while (std::regex_search(data, token, RANGE_REG))
+    const auto count = out.size() / mask_.size();
+
+    random::WordBuffer words{count * (digitPositions_.size() / 16 + nonZeroDigitPositions_.size() / 20 + 2)};
+
+    for (std::size_t i = 0; i < count; i++)
     {
-        int min = std::stoi(token[1]); // This time we are not capturing the char before `[]`
-        int max = std::stoi(token[2]);
-        if (min > max)
-        {
-            std::swap(min, max);
-        }
+        fill(out.subspan(i * mask_.size(), mask_.size()), words);
+    }
+}
+
+std::size_t DigitTemplate::size() const
+{
+    return mask_.size();
+}
+
+template <class Generator>
+void DigitTemplate::fill(std::span<char> out, Generator& generator) const
+{
+    std::ranges::copy(mask_, out.begin());
 
-        data = data.substr(0, static_cast<unsigned long>(token.position())) +
-               std::to_string(number::integer(min, max)) +
-               data.substr(static_cast<unsigned long>(token.position() + token.length()));
+    DigitSource digits{generator};
+
+    for (const auto position : digitPositions_)
+    {
+        out[position] = digits.digit();
     }
 
-    return data;
+    for (const auto position : nonZeroDigitPositions_)
+    {
+        out[position] = digits.nonZeroDigit();
+    }
 }
 }
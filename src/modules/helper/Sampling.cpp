@@ -0,0 +1,70 @@
+#include "faker-cxx/Sampling.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace faker::helper
+{
+namespace
+{
+unsigned hardwareThreadCount(unsigned threadCount)
+{
+    return threadCount != 0 ? threadCount : (std::max)(std::thread::hardware_concurrency(), 1u);
+}
+}
+
+void detail::parallelFor(std::size_t taskCount, unsigned threadCount,
+                         const std::function<void(std::size_t)>& task)
+{
+    std::atomic<std::size_t> nextTask{0};
+    std::mutex errorMutex;
+    std::exception_ptr error;
+
+    const auto work = [&]
+    {
+        for (auto index = nextTask.fetch_add(1); index < taskCount; index = nextTask.fetch_add(1))
+        {
+            try
+            {
+                task(index);
+            }
+            catch (...)
+            {
+                const std::lock_guard lock{errorMutex};
+
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+
+                // Skips the remaining tasks.
+                nextTask.store(taskCount);
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> workers;
+
+        const auto workerCount = (std::min)(std::size_t{hardwareThreadCount(threadCount)}, taskCount);
+
+        for (std::size_t worker = 1; worker < workerCount; worker++)
+        {
+            workers.emplace_back(work);
+        }
+
+        work();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+}
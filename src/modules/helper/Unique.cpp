@@ -0,0 +1,124 @@
+#include "faker-cxx/Unique.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "faker-cxx/Random.h"
+
+namespace faker::helper
+{
+namespace
+{
+constexpr std::size_t bloomBlockWords = 8;
+constexpr double bloomBlockBits = 512;
+}
+
+BloomFilter::BloomFilter(std::uint64_t expectedCount, double falsePositiveRate)
+{
+    if (expectedCount == 0)
+    {
+        throw std::invalid_argument{"Expected count must be greater than zero."};
+    }
+
+    if (!(falsePositiveRate > 0 && falsePositiveRate < 1))
+    {
+        throw std::invalid_argument{"False positive rate must be between 0 and 1."};
+    }
+
+    const auto log2 = std::log(2.0);
+    const auto bitCount = std::ceil(-static_cast<double>(expectedCount) * std::log(falsePositiveRate) / (log2 * log2));
+
+    hashCount_ = static_cast<unsigned>(
+        std::clamp(std::round(bitCount / static_cast<double>(expectedCount) * log2), 1.0, 16.0));
+    blockCount_ = (std::max)(static_cast<std::uint64_t>(std::ceil(bitCount / bloomBlockBits)), std::uint64_t{1});
+
+    words_.assign(blockCount_ * bloomBlockWords, 0);
+}
+
+bool BloomFilter::insert(std::uint64_t hash)
+{
+    std::uint64_t low;
+
+    auto* block = words_.data() + random::detail::multiplyHigh(hash, blockCount_, low) * bloomBlockWords;
+
+    bool added = false;
+
+    for (unsigned i = 0; i < hashCount_; i++)
+    {
+        const auto bit = random::detail::splitMix64(hash) >> 55;
+        const auto mask = std::uint64_t{1} << (bit % 64);
+
+        added = added || (block[bit / 64] & mask) == 0;
+        block[bit / 64] |= mask;
+    }
+
+    return added;
+}
+
+bool BloomFilter::mayContain(std::uint64_t hash) const
+{
+    std::uint64_t low;
+
+    const auto* block = words_.data() + random::detail::multiplyHigh(hash, blockCount_, low) * bloomBlockWords;
+
+    for (unsigned i = 0; i < hashCount_; i++)
+    {
+        const auto bit = random::detail::splitMix64(hash) >> 55;
+
+        if ((block[bit / 64] >> (bit % 64) & 1) == 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::size_t BloomFilter::memoryBytes() const
+{
+    return words_.size() * sizeof(std::uint64_t);
+}
+
+void detail::UniqueSetState::configure(const UniqueOptions& options, std::size_t shardCount)
+{
+    exactLimit_ = options.exactLimit / shardCount;
+    overflow_ = options.overflow;
+    expectedCount_ = (std::max)(options.expectedCount / shardCount, std::uint64_t{1});
+    falsePositiveRate_ = options.falsePositiveRate;
+}
+
+bool detail::UniqueSetState::count(bool inserted)
+{
+    if (inserted)
+    {
+        generated_++;
+    }
+    else
+    {
+        rejected_++;
+    }
+
+    return inserted;
+}
+
+bool detail::UniqueSetState::exceedsExactLimit(std::size_t exactCount) const
+{
+    return overflow_ == UniqueOverflow::Approximate && exactCount > exactLimit_;
+}
+
+BloomFilter& detail::UniqueSetState::startFilter()
+{
+    return filter_.emplace(expectedCount_, falsePositiveRate_);
+}
+
+void detail::UniqueSetState::addStats(UniqueStats& stats, std::size_t exactBytes) const
+{
+    stats.generated += generated_;
+    stats.rejected += rejected_;
+    stats.approximate = stats.approximate || filter_.has_value();
+    stats.memoryBytes += filter_ ? filter_->memoryBytes() : exactBytes;
+}
+}
@@ -0,0 +1,144 @@
+#include "faker-cxx/ValuePool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "faker-cxx/Random.h"
+#include "faker-cxx/Sampling.h"
+
+namespace faker::helper
+{
+namespace
+{
+constexpr std::size_t valuesPerChunk = 256;
+}
+
+ValuePool::ValuePool(std::size_t size, std::function<void(std::string&)> append, const ValuePoolOptions& options)
+    : append_{std::move(append)}, options_{options}, uniformIndex_{size - 1}
+{
+    if (size == 0)
+    {
+        throw std::invalid_argument{"Pool size must be positive."};
+    }
+
+    if (options.distribution == PoolDistribution::Zipf)
+    {
+        zipfRank_.emplace(size, options.zipfExponent);
+    }
+
+    arena_ = fill(size, append_, options.threadCount);
+    filledAt_ = std::chrono::steady_clock::now();
+}
+
+std::shared_ptr<const ValuePool::Arena> ValuePool::fill(std::size_t size,
+                                                        const std::function<void(std::string&)>& append,
+                                                        unsigned threadCount)
+{
+    struct Chunk
+    {
+        std::string text;
+        std::vector<std::size_t> ends;
+    };
+
+    // Values are generated in chunks of consecutive indices, each keyed by its index, so the chunking does not change
+    // the values.
+    const auto chunkCount = (size + valuesPerChunk - 1) / valuesPerChunk;
+    const auto key = random::engine()();
+
+    std::vector<Chunk> chunks(chunkCount);
+
+    detail::parallelFor(chunkCount, threadCount,
+                        [&](std::size_t chunkIndex)
+                        {
+                            auto& chunk = chunks[chunkIndex];
+
+                            for (auto index = chunkIndex * valuesPerChunk;
+                                 index < (std::min)(size, (chunkIndex + 1) * valuesPerChunk); index++)
+                            {
+                                const random::RecordScope record{key, index};
+
+                                append(chunk.text);
+                                chunk.ends.push_back(chunk.text.size());
+                            }
+                        });
+
+    auto arena = std::make_shared<Arena>();
+    std::size_t textSize = 0;
+
+    for (const auto& chunk : chunks)
+    {
+        textSize += chunk.text.size();
+    }
+
+    arena->text.reserve(textSize);
+    arena->offsets.reserve(size + 1);
+    arena->offsets.push_back(0);
+
+    for (const auto& chunk : chunks)
+    {
+        const auto base = arena->text.size();
+
+        arena->text += chunk.text;
+
+        for (const auto end : chunk.ends)
+        {
+            arena->offsets.push_back(base + end);
+        }
+    }
+
+    return arena;
+}
+
+std::string_view ValuePool::operator()()
+{
+    if (options_.refreshAfterDraws != 0 && drawsSinceRefresh_ == options_.refreshAfterDraws)
+    {
+        refresh();
+    }
+
+    // Reading the clock costs more than the draw, the age is checked once every 1024 draws.
+    if (options_.refreshInterval != std::chrono::steady_clock::duration::zero() && drawsSinceRefresh_ % 1024 == 1023 &&
+        std::chrono::steady_clock::now() - filledAt_ >= options_.refreshInterval)
+    {
+        refresh();
+    }
+
+    drawsSinceRefresh_++;
+
+    const auto index = zipfRank_ ? (*zipfRank_)() - 1 : uniformIndex_(random::engine());
+
+    return (*this)[index];
+}
+
+std::string_view ValuePool::operator[](std::size_t index) const
+{
+    const auto& offsets = arena_->offsets;
+
+    return std::string_view{arena_->text}.substr(offsets[index], offsets[index + 1] - offsets[index]);
+}
+
+void ValuePool::refresh()
+{
+    arena_ = fill(size(), append_, options_.threadCount);
+    drawsSinceRefresh_ = 0;
+    filledAt_ = std::chrono::steady_clock::now();
+}
+
+std::size_t ValuePool::size() const
+{
+    return arena_->offsets.size() - 1;
+}
+
+std::size_t ValuePool::arenaBytes() const
+{
+    return arena_->text.size();
+}
+}
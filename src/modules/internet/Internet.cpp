@@ -147,10 +147,7 @@ std::string password(int length, const PasswordOptions& options)
 
     std::string password;
 
-    for (int i = 0; i < length; ++i)
-    {
-        password += helper::arrayElement<char>(characters);
-    }
+    string::fromCharacters(password, characters, static_cast<unsigned>((std::max)(length, 0)));
 
     return password;
 }
@@ -333,6 +330,11 @@ std::string_view domainSuffix()
     return helper::arrayElement(domainSuffixes);
 }
 
+std::string_view domainSuffix(double skew)
+{
+    return helper::zipfArrayElement(domainSuffixes, skew);
+}
+
 std::string anonymousUsername(unsigned maxLength)
 {
     unsigned defaultMin = 6;
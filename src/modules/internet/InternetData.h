@@ -5,13 +5,14 @@
 
 namespace faker::internet
 {
+// Ordered by the number of registered domains, the skewed domainSuffix draws the first suffixes the most.
 const auto domainSuffixes = std::to_array<std::string_view>({
-    "biz",
     "com",
+    "org",
+    "net",
     "info",
+    "biz",
     "name",
-    "net",
-    "org",
 });
 
 const auto emailHosts = std::to_array<std::string_view>({
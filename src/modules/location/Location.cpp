@@ -94,6 +94,52 @@ Country getCountry(const AddressCountry& addressCountry)
         return Country::Usa;
     }
 }
+
+struct AddressContext
+{
+    AddressCountry country;
+    const CountryAddressesInfo& addresses;
+};
+
+thread_local common::TokenTemplateCache<AddressContext> cityTemplates{
+    {"firstName",
+     [](const AddressContext& context, std::string& out) { out += person::firstName(getCountry(context.country)); }},
+    {"lastName",
+     [](const AddressContext& context, std::string& out) { out += person::lastName(getCountry(context.country)); }},
+    {"cityName", [](const AddressContext& context, std::string& out)
+     { out += helper::arrayElement(context.addresses.cities); }},
+    {"cityPrefix", [](const AddressContext& context, std::string& out)
+     { out += helper::arrayElement(context.addresses.cityPrefixes); }},
+    {"citySuffix", [](const AddressContext& context, std::string& out)
+     { out += helper::arrayElement(context.addresses.citySuffixes); }}};
+
+void appendCity(const AddressContext& context, std::string& out)
+{
+    cityTemplates[helper::arrayElement(context.addresses.cityFormats)].render(context, out);
+}
+
+thread_local common::TokenTemplateCache<AddressContext> streetTemplates{
+    {"firstName",
+     [](const AddressContext& context, std::string& out) { out += person::firstName(getCountry(context.country)); }},
+    {"lastName",
+     [](const AddressContext& context, std::string& out) { out += person::lastName(getCountry(context.country)); }},
+    {"streetName", [](const AddressContext& context, std::string& out)
+     { out += helper::arrayElement(context.addresses.streetNames); }},
+    {"streetPrefix", [](const AddressContext& context, std::string& out)
+     { out += helper::arrayElement(context.addresses.streetPrefixes); }},
+    {"streetSuffix", [](const AddressContext& context, std::string& out)
+     { out += helper::arrayElement(context.addresses.streetSuffixes); }}};
+
+void appendStreet(const AddressContext& context, std::string& out)
+{
+    streetTemplates[helper::arrayElement(context.addresses.streetFormats)].render(context, out);
+}
+
+thread_local common::TokenTemplateCache<AddressContext> addressTemplates{
+    {"buildingNumber", [](const AddressContext& context, std::string& out) { out += buildingNumber(context.country); }},
+    {"street", appendStreet},
+    {"secondaryAddress",
+     [](const AddressContext& context, std::string& out) { out += secondaryAddress(context.country); }}};
 }
 
 std::string_view country()
@@ -117,19 +163,11 @@ std::string city(AddressCountry country)
 {
     const auto& countryAddresses = getAddresses(country);
 
-    const auto cityFormat = static_cast<std::string>(helper::arrayElement(countryAddresses.cityFormats));
+    std::string result;
 
-    const auto dataGeneratorsMapping = std::unordered_map<std::string, std::function<std::string()>>{
-        {"firstName", [&country]() { return static_cast<std::string>(person::firstName(getCountry(country))); }},
-        {"lastName", [&country]() { return static_cast<std::string>(person::lastName(getCountry(country))); }},
-        {"cityName",
-         [&countryAddresses]() { return static_cast<std::string>(helper::arrayElement(countryAddresses.cities)); }},
-        {"cityPrefix", [&countryAddresses]()
-         { return static_cast<std::string>(helper::arrayElement(countryAddresses.cityPrefixes)); }},
-        {"citySuffix", [&countryAddresses]()
-         { return static_cast<std::string>(helper::arrayElement(countryAddresses.citySuffixes)); }}};
+    appendCity({country, countryAddresses}, result);
 
-    return common::fillTokenValues(cityFormat, dataGeneratorsMapping);
+    return result;
 }
 
 std::string zipCode(AddressCountry country)
@@ -143,33 +181,18 @@ std::string streetAddress(AddressCountry country)
 {
     const auto& countryAddresses = getAddresses(country);
 
-    const auto dataGeneratorsMapping = std::unordered_map<std::string, std::function<std::string()>>{
-        {"buildingNumber", [&country]() { return buildingNumber(country); }},
-        {"street", [&country]() { return street(country); }},
-        {"secondaryAddress", [&country]() { return secondaryAddress(country); }}};
-
-    const auto addressFormat = static_cast<std::string>(helper::arrayElement(countryAddresses.addressFormats));
-
-    return common::fillTokenValues(addressFormat, dataGeneratorsMapping);
+    return addressTemplates[helper::arrayElement(countryAddresses.addressFormats)].render({country, countryAddresses});
 }
 
 std::string street(AddressCountry country)
 {
     const auto& countryAddresses = getAddresses(country);
 
-    const auto streetFormat = static_cast<std::string>(helper::arrayElement(countryAddresses.streetFormats));
+    std::string result;
 
-    const auto dataGeneratorsMapping = std::unordered_map<std::string, std::function<std::string()>>{
-        {"firstName", [&country]() { return static_cast<std::string>(person::firstName(getCountry(country))); }},
-        {"lastName", [&country]() { return static_cast<std::string>(person::lastName(getCountry(country))); }},
-        {"streetName", [&countryAddresses]()
-         { return static_cast<std::string>(helper::arrayElement(countryAddresses.streetNames)); }},
-        {"streetPrefix", [&countryAddresses]()
-         { return static_cast<std::string>(helper::arrayElement(countryAddresses.streetPrefixes)); }},
-        {"streetSuffix", [&countryAddresses]()
-         { return static_cast<std::string>(helper::arrayElement(countryAddresses.streetSuffixes)); }}};
+    appendStreet({country, countryAddresses}, result);
 
-    return common::fillTokenValues(streetFormat, dataGeneratorsMapping);
+    return result;
 }
 
 std::string buildingNumber(AddressCountry country)
@@ -0,0 +1,591 @@
+#include "faker-cxx/Number.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+#include "faker-cxx/Random.h"
+
+namespace faker::number
+{
+namespace
+{
+constexpr std::size_t zigguratLayerCount = 256;
+
+// Layer boundaries of a 256 layer ziggurat, x[0] is the width of the base strip and x[256] is 0.
+struct ZigguratTables
+{
+    std::array<double, zigguratLayerCount + 1> x;
+    std::array<double, zigguratLayerCount + 1> f;
+};
+
+double normalDensity(double x)
+{
+    return std::exp(-x * x / 2);
+}
+
+double exponentialDensity(double x)
+{
+    return std::exp(-x);
+}
+
+// Marsaglia and Tsang: every layer, and the base strip including the tail, has the area v.
+template <class Density, class InverseDensity>
+ZigguratTables makeZigguratTables(double r, double v, Density density, InverseDensity inverseDensity)
+{
+    ZigguratTables tables{};
+
+    tables.x[0] = v / density(r);
+    tables.x[1] = r;
+
+    for (std::size_t i = 2; i < zigguratLayerCount; i++)
+    {
+        tables.x[i] = inverseDensity(v / tables.x[i - 1] + density(tables.x[i - 1]));
+    }
+
+    tables.x[zigguratLayerCount] = 0;
+
+    for (std::size_t i = 0; i <= zigguratLayerCount; i++)
+    {
+        tables.f[i] = density(tables.x[i]);
+    }
+
+    return tables;
+}
+
+const ZigguratTables& normalTables()
+{
+    static const ZigguratTables tables = makeZigguratTables(
+        3.6541528853610088, 0.00492867323399, normalDensity, [](double y) { return std::sqrt(-2 * std::log(y)); });
+
+    return tables;
+}
+
+const ZigguratTables& exponentialTables()
+{
+    static const ZigguratTables tables = makeZigguratTables(7.69711747013104972, 0.0039496598225815571993,
+                                                            exponentialDensity, [](double y) { return -std::log(y); });
+
+    return tables;
+}
+
+// Uniform value in (0, 1), never 0 so it can be passed to std::log.
+double openUnit(std::uint64_t word)
+{
+    return (static_cast<double>(word >> 11) + 0.5) * 0x1.0p-53;
+}
+
+// The low 8 bits of a word select the layer and the high 52 bits give the position inside it.
+template <class Generator>
+double standardNormal(Generator& generator, const ZigguratTables& tables)
+{
+    while (true)
+    {
+        const auto word = generator();
+        const auto layer = static_cast<std::size_t>(word & 0xff);
+        const auto u = 2 * ((static_cast<double>(word >> 12) + 0.5) * 0x1.0p-52) - 1;
+        const auto x = u * tables.x[layer];
+
+        if (std::abs(x) < tables.x[layer + 1])
+        {
+            return x;
+        }
+
+        if (layer == 0)
+        {
+            // Tail beyond r, Marsaglia's method.
+            const auto r = tables.x[1];
+
+            double tailX;
+            double tailY;
+
+            do
+            {
+                tailX = -std::log(openUnit(generator())) / r;
+                tailY = -std::log(openUnit(generator()));
+            } while (2 * tailY < tailX * tailX);
+
+            return u < 0 ? -(r + tailX) : r + tailX;
+        }
+
+        const auto y = tables.f[layer + 1] + (tables.f[layer] - tables.f[layer + 1]) * openUnit(generator());
+
+        if (y < normalDensity(x))
+        {
+            return x;
+        }
+    }
+}
+
+template <class Generator>
+double standardExponential(Generator& generator, const ZigguratTables& tables)
+{
+    while (true)
+    {
+        const auto word = generator();
+        const auto layer = static_cast<std::size_t>(word & 0xff);
+        const auto x = (static_cast<double>(word >> 12) + 0.5) * 0x1.0p-52 * tables.x[layer];
+
+        if (x < tables.x[layer + 1])
+        {
+            return x;
+        }
+
+        if (layer == 0)
+        {
+            // The exponential tail is memoryless, so it is the same distribution shifted by r.
+            return tables.x[1] - std::log(openUnit(generator()));
+        }
+
+        const auto y = tables.f[layer + 1] + (tables.f[layer] - tables.f[layer + 1]) * openUnit(generator());
+
+        if (y < exponentialDensity(x))
+        {
+            return x;
+        }
+    }
+}
+
+// Below this mean inversion by sequential search is faster than transformed rejection.
+constexpr double poissonInversionLimit = 10;
+
+template <class Generator>
+std::uint64_t poissonByInversion(Generator& generator, double mean)
+{
+    auto probability = std::exp(-mean);
+    auto cumulative = probability;
+    const auto u = openUnit(generator());
+
+    std::uint64_t k = 0;
+
+    // The cumulative sum can fall short of 1 by rounding, the tail cut-off bounds the loop.
+    while (u > cumulative && probability > 0)
+    {
+        k++;
+        probability *= mean / static_cast<double>(k);
+        cumulative += probability;
+    }
+
+    return k;
+}
+
+// Hörmann's PTRS, transformed rejection with squeeze.
+class PoissonRejection
+{
+public:
+    explicit PoissonRejection(double mean)
+        : mean_{mean},
+          logMean_{std::log(mean)},
+          b_{0.931 + 2.53 * std::sqrt(mean)},
+          a_{-0.059 + 0.02483 * b_},
+          logInverseAlpha_{std::log(1.1239 + 1.1328 / (b_ - 3.4))},
+          acceptanceLimit_{0.9277 - 3.6224 / (b_ - 2)}
+    {
+    }
+
+    template <class Generator>
+    std::uint64_t operator()(Generator& generator) const
+    {
+        while (true)
+        {
+            const auto u = openUnit(generator()) - 0.5;
+            const auto v = openUnit(generator());
+            const auto us = 0.5 - std::abs(u);
+            const auto k = std::floor((2 * a_ / us + b_) * u + mean_ + 0.43);
+
+            if (us >= 0.07 && v <= acceptanceLimit_)
+            {
+                return static_cast<std::uint64_t>(k);
+            }
+
+            if (k < 0 || (us < 0.013 && v > us))
+            {
+                continue;
+            }
+
+            if (std::log(v) + logInverseAlpha_ - std::log(a_ / (us * us) + b_) <=
+                -mean_ + k * logMean_ - std::lgamma(k + 1))
+            {
+                return static_cast<std::uint64_t>(k);
+            }
+        }
+    }
+
+private:
+    double mean_;
+    double logMean_;
+    double b_;
+    double a_;
+    double logInverseAlpha_;
+    double acceptanceLimit_;
+};
+
+void validateStandardDeviation(double standardDeviation)
+{
+    if (!(standardDeviation >= 0))
+    {
+        throw std::invalid_argument("Standard deviation must not be negative.");
+    }
+}
+
+void validateRate(double rate)
+{
+    if (!(rate > 0))
+    {
+        throw std::invalid_argument("Rate must be greater than zero.");
+    }
+}
+
+// Accepted draws stay within a few square roots of the mean, so they fit in 64 bits up to this mean.
+constexpr double maxPoissonMean = 0x1p62;
+
+void validateMean(double mean)
+{
+    if (!(mean >= 0))
+    {
+        throw std::invalid_argument("Mean must not be negative.");
+    }
+
+    if (!(mean <= maxPoissonMean))
+    {
+        throw std::invalid_argument("Mean must be finite and not greater than 2^62.");
+    }
+}
+
+// log1p(x) / x and expm1(x) / x with their series limits near 0.
+double log1pQuotient(double x)
+{
+    if (std::abs(x) > 1e-8)
+    {
+        return std::log1p(x) / x;
+    }
+
+    return 1 - x * (0.5 - x * (1.0 / 3 - 0.25 * x));
+}
+
+double expm1Quotient(double x)
+{
+    if (std::abs(x) > 1e-8)
+    {
+        return std::expm1(x) / x;
+    }
+
+    return 1 + x * 0.5 * (1 + x * (1.0 / 3) * (1 + 0.25 * x));
+}
+
+template <class Generator>
+std::uint64_t poissonWith(Generator& generator, double mean)
+{
+    if (mean < poissonInversionLimit)
+    {
+        return poissonByInversion(generator, mean);
+    }
+
+    return PoissonRejection{mean}(generator);
+}
+}
+
+double normal(double mean, double standardDeviation)
+{
+    validateStandardDeviation(standardDeviation);
+
+    return mean + standardDeviation * standardNormal(random::engine(), normalTables());
+}
+
+void normals(std::span<double> out, double mean, double standardDeviation)
+{
+    validateStandardDeviation(standardDeviation);
+
+    const auto& tables = normalTables();
+
+    random::WordBuffer words{out.size()};
+
+    for (auto& value : out)
+    {
+        value = mean + standardDeviation * standardNormal(words, tables);
+    }
+}
+
+double lognormal(double logMean, double logStandardDeviation)
+{
+    return std::exp(normal(logMean, logStandardDeviation));
+}
+
+void lognormals(std::span<double> out, double logMean, double logStandardDeviation)
+{
+    normals(out, logMean, logStandardDeviation);
+
+    for (auto& value : out)
+    {
+        value = std::exp(value);
+    }
+}
+
+double exponential(double rate)
+{
+    validateRate(rate);
+
+    return standardExponential(random::engine(), exponentialTables()) / rate;
+}
+
+void exponentials(std::span<double> out, double rate)
+{
+    validateRate(rate);
+
+    const auto& tables = exponentialTables();
+
+    random::WordBuffer words{out.size()};
+
+    for (auto& value : out)
+    {
+        value = standardExponential(words, tables) / rate;
+    }
+}
+
+std::uint64_t poisson(double mean)
+{
+    validateMean(mean);
+
+    return poissonWith(random::engine(), mean);
+}
+
+void poissons(std::span<std::uint64_t> out, double mean)
+{
+    validateMean(mean);
+
+    random::WordBuffer words{out.size() * 2};
+
+    if (mean < poissonInversionLimit)
+    {
+        for (auto& value : out)
+        {
+            value = poissonByInversion(words, mean);
+        }
+
+        return;
+    }
+
+    const PoissonRejection rejection{mean};
+
+    for (auto& value : out)
+    {
+        value = rejection(words);
+    }
+}
+
+ZipfSampler::ZipfSampler(std::uint64_t elementCount, double exponent)
+    : elementCount_{elementCount}, exponent_{exponent}
+{
+    if (elementCount == 0)
+    {
+        throw std::invalid_argument("Element count must be greater than zero.");
+    }
+
+    if (!(exponent >= 0))
+    {
+        throw std::invalid_argument("Exponent must not be negative.");
+    }
+
+    hIntegralX1_ = hIntegral(1.5) - 1;
+    hIntegralElementCount_ = hIntegral(static_cast<double>(elementCount) + 0.5);
+    s_ = 2 - hIntegralInverse(hIntegral(2.5) - h(2));
+}
+
+std::uint64_t ZipfSampler::operator()() const
+{
+    return sample(random::engine());
+}
+
+void ZipfSampler::operator()(std::span<std::uint64_t> out) const
+{
+    random::WordBuffer words{out.size()};
+
+    for (auto& value : out)
+    {
+        value = sample(words);
+    }
+}
+
+std::uint64_t ZipfSampler::elementCount() const
+{
+    return elementCount_;
+}
+
+double ZipfSampler::exponent() const
+{
+    return exponent_;
+}
+
+template <class Generator>
+std::uint64_t ZipfSampler::sample(Generator& generator) const
+{
+    while (true)
+    {
+        const auto u = hIntegralElementCount_ +
+                       random::toUnitInterval<double>(generator()) * (hIntegralX1_ - hIntegralElementCount_);
+        const auto x = hIntegralInverse(u);
+
+        auto k = x + 0.5;
+
+        if (k < 1)
+        {
+            k = 1;
+        }
+        else if (k > static_cast<double>(elementCount_))
+        {
+            k = static_cast<double>(elementCount_);
+        }
+
+        const auto rank = static_cast<std::uint64_t>(k);
+        const auto roundedRank = static_cast<double>(rank);
+
+        // Most draws are accepted by the first test without evaluating the integral.
+        if (roundedRank - x <= s_ || u >= hIntegral(roundedRank + 0.5) - h(roundedRank))
+        {
+            return rank;
+        }
+    }
+}
+
+double ZipfSampler::h(double x) const
+{
+    return std::exp(-exponent_ * std::log(x));
+}
+
+// Integral of h from 1 to x, written with expm1 so it stays accurate for exponents close to 1.
+double ZipfSampler::hIntegral(double x) const
+{
+    const auto logX = std::log(x);
+
+    return expm1Quotient((1 - exponent_) * logX) * logX;
+}
+
+double ZipfSampler::hIntegralInverse(double x) const
+{
+    auto t = x * (1 - exponent_);
+
+    if (t < -1)
+    {
+        t = -1;
+    }
+
+    return std::exp(log1pQuotient(t) * x);
+}
+
+std::uint64_t zipf(std::uint64_t elementCount, double exponent)
+{
+    return ZipfSampler{elementCount, exponent}();
+}
+
+Permutation::Permutation(std::uint64_t min, std::uint64_t max, std::uint64_t key) : min_{min}, maxOffset_{max - min}
+{
+    if (min > max)
+    {
+        throw std::invalid_argument("Minimum value must be smaller than maximum value.");
+    }
+
+    // A Feistel network permutes an even number of bits, a range of a single value still gets one bit per half.
+    halfBits_ = (std::max)((static_cast<unsigned>(std::bit_width(maxOffset_)) + 1) / 2, 1u);
+    halfMask_ = halfBits_ == 32 ? 0xffffffffull : (std::uint64_t{1} << halfBits_) - 1;
+
+    for (auto& roundKey : roundKeys_)
+    {
+        roundKey = random::detail::splitMix64(key);
+    }
+}
+
+Permutation::Permutation(std::uint64_t min, std::uint64_t max) : Permutation{min, max, random::engine()()} {}
+
+std::uint64_t Permutation::operator()(std::uint64_t index) const
+{
+    if (index > maxOffset_)
+    {
+        throw std::invalid_argument("Index is outside of the permuted range.");
+    }
+
+    auto block = encrypt(index);
+
+    // Cycle-walking: a permutation of the covering bit range restricted to [0, maxOffset] by iterating it.
+    while (block > maxOffset_)
+    {
+        block = encrypt(block);
+    }
+
+    return min_ + block;
+}
+
+std::uint64_t Permutation::inverse(std::uint64_t value) const
+{
+    if (value < min_ || value - min_ > maxOffset_)
+    {
+        throw std::invalid_argument("Value is outside of the permuted range.");
+    }
+
+    auto block = decrypt(value - min_);
+
+    while (block > maxOffset_)
+    {
+        block = decrypt(block);
+    }
+
+    return block;
+}
+
+std::uint64_t Permutation::min() const
+{
+    return min_;
+}
+
+std::uint64_t Permutation::max() const
+{
+    return min_ + maxOffset_;
+}
+
+std::uint64_t Permutation::encrypt(std::uint64_t block) const
+{
+    auto left = block >> halfBits_;
+    auto right = block & halfMask_;
+
+    for (unsigned i = 0; i < roundCount; i++)
+    {
+        const auto next = left ^ round(i, right);
+
+        left = right;
+        right = next;
+    }
+
+    return left << halfBits_ | right;
+}
+
+std::uint64_t Permutation::decrypt(std::uint64_t block) const
+{
+    auto left = block >> halfBits_;
+    auto right = block & halfMask_;
+
+    for (unsigned i = roundCount; i-- > 0;)
+    {
+        const auto previous = right ^ round(i, left);
+
+        right = left;
+        left = previous;
+    }
+
+    return left << halfBits_ | right;
+}
+
+// The splitmix64 finalizer keyed per round, truncated to the half width.
+std::uint64_t Permutation::round(unsigned index, std::uint64_t half) const
+{
+    auto z = half ^ roundKeys_[index];
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+
+    return (z ^ (z >> 31)) & halfMask_;
+}
+}
@@ -1,8 +1,10 @@
 #include "faker-cxx/Person.h"
 
 #include <optional>
+#include <span>
 #include <string>
 #include <unordered_map>
+#include <variant>
 #include <vector>
 
 #include "common/FormatHelper.h"
@@ -157,6 +159,35 @@ const struct PeopleNames& getPeopleNamesByCountry(const Country& country)
     }
 }
 
+struct NameContext
+{
+    Country country;
+    std::optional<Sex> sex;
+};
+
+// Name formats are drawn on every fullName call, so each thread builds the alias table of a country once.
+const helper::WeightedSampler<std::string_view>& nameFormatSampler(Country country,
+                                                                  const struct PeopleNames& peopleNames)
+{
+    thread_local std::unordered_map<Country, helper::WeightedSampler<std::string_view>> samplers;
+
+    auto sampler = samplers.find(country);
+
+    if (sampler == samplers.end())
+    {
+        std::vector<helper::WeightedElement<std::string_view>> weightedElements;
+
+        for (const auto& nameFormat : peopleNames.nameFormats)
+        {
+            weightedElements.push_back({nameFormat.weight, nameFormat.format});
+        }
+
+        sampler = samplers.emplace(country, helper::WeightedSampler{weightedElements}).first;
+    }
+
+    return sampler->second;
+}
+
 }
 
 std::string_view firstName(std::optional<Country> countryOpt, std::optional<Sex> sex)
@@ -229,22 +260,15 @@ std::string fullName(std::optional<Country> countryOpt, std::optional<Sex> sex)
 
     const auto& peopleNames = getPeopleNamesByCountry(country);
 
-    std::vector<helper::WeightedElement<std::string_view>> weightedElements;
-
-    for (const auto& nameFormat : peopleNames.nameFormats)
-    {
-        weightedElements.push_back({nameFormat.weight, nameFormat.format});
-    }
-
-    const auto nameFormat = static_cast<std::string>(helper::weightedArrayElement<std::string_view>(weightedElements));
+    thread_local common::TokenTemplateCache<NameContext> nameTemplates{
+        {"firstName",
+         [](const NameContext& context, std::string& out) { out += firstName(context.country, context.sex); }},
+        {"lastName",
+         [](const NameContext& context, std::string& out) { out += lastName(context.country, context.sex); }},
+        {"prefix", [](const NameContext& context, std::string& out) { out += prefix(context.country, context.sex); }},
+        {"suffix", [](const NameContext& context, std::string& out) { out += suffix(context.country, context.sex); }}};
 
-    const auto dataGeneratorsMapping = std::unordered_map<std::string, std::function<std::string()>>{
-        {"firstName", [&country, &sex]() { return std::string{firstName(country, sex)}; }},
-        {"lastName", [&country, &sex]() { return std::string{lastName(country, sex)}; }},
-        {"prefix", [&country, &sex]() { return std::string{prefix(country, sex)}; }},
-        {"suffix", [&country, &sex]() { return std::string{suffix(country, sex)}; }}};
-
-    return common::fillTokenValues(nameFormat, dataGeneratorsMapping);
+    return nameTemplates[nameFormatSampler(country, peopleNames)()].render({country, sex});
 }
 
 std::string_view prefix(std::optional<Country> countryOpt, std::optional<Sex> sex)
@@ -323,15 +347,13 @@ std::string_view suffix(std::optional<Country> countryOpt, std::optional<Sex> se
 
 std::string bio()
 {
-    const auto randomBioFormat = static_cast<std::string>(helper::arrayElement(bioFormats));
-
-    const std::unordered_map<std::string_view, std::function<std::string_view()>> dataGeneratorsMapping{
-        {"bio_part", []() { return helper::arrayElement(bioParts); }},
-        {"bio_supporter", []() { return helper::arrayElement(bioSupporters); }},
-        {"noun", []() { return word::noun(); }},
-        {"emoji", []() { return internet::emoji(); }}};
+    thread_local common::TokenTemplateCache<std::monostate> bioTemplates{
+        {"bio_part", [](const std::monostate&, std::string& out) { out += helper::arrayElement(bioParts); }},
+        {"bio_supporter", [](const std::monostate&, std::string& out) { out += helper::arrayElement(bioSupporters); }},
+        {"noun", [](const std::monostate&, std::string& out) { out += word::noun(); }},
+        {"emoji", [](const std::monostate&, std::string& out) { out += internet::emoji(); }}};
 
-    return common::fillTokenValues(randomBioFormat, dataGeneratorsMapping);
+    return bioTemplates[helper::arrayElement(bioFormats)].render({});
 }
 
 std::string_view sex(std::optional<Language> languageOpt)
@@ -400,27 +422,24 @@ std::string ssn(std::optional<SsnCountry> country)
 
     const auto& ssnFormat = std::string{ssnFormats.at(ssnCountry)};
 
-    auto ssnWithoutRegexes = helper::regexpStyleStringParse(ssnFormat);
-
-    std::string ssn;
+    auto ssn = helper::regexpStyleStringParse(ssnFormat);
 
-    for (const auto& ssnFormatCharacter : ssnWithoutRegexes)
+    // Placeholders are overwritten in place, so the number is generated without building intermediate strings.
+    for (auto& ssnFormatCharacter : ssn)
     {
+        const std::span<char> position{&ssnFormatCharacter, 1};
+
         if (ssnFormatCharacter == 'L')
         {
-            ssn += string::alpha(1, string::StringCasing::Upper);
+            string::alpha(position, string::StringCasing::Upper);
         }
         else if (ssnFormatCharacter == 'F')
         {
-            ssn += string::alphanumeric(1, string::StringCasing::Upper);
+            string::alphanumeric(position, string::StringCasing::Upper);
         }
         else if (ssnFormatCharacter == '#')
         {
-            ssn += std::to_string(number::integer(0, 9));
-        }
-        else
-        {
-            ssn += ssnFormatCharacter;
+            string::numeric(position);
         }
     }
 
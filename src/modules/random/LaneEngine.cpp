@@ -0,0 +1,244 @@
+#include "LaneEngine.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "faker-cxx/Random.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define FAKER_CXX_HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace faker::random
+{
+namespace
+{
+constexpr std::size_t laneCount = LaneEngine::laneCount;
+
+void fillScalar(LaneEngine::State& state, std::uint64_t* out, std::size_t blocks)
+{
+    auto& [s0, s1, s2, s3] = state;
+
+    for (std::size_t block = 0; block < blocks; block++)
+    {
+        for (std::size_t lane = 0; lane < laneCount; lane++)
+        {
+            const std::uint64_t result = detail::rotateLeft(s1[lane] * 5, 7) * 9;
+            const std::uint64_t shifted = s1[lane] << 17;
+
+            s2[lane] ^= s0[lane];
+            s3[lane] ^= s1[lane];
+            s1[lane] ^= s2[lane];
+            s0[lane] ^= s3[lane];
+            s2[lane] ^= shifted;
+            s3[lane] = detail::rotateLeft(s3[lane], 45);
+
+            out[block * laneCount + lane] = result;
+        }
+    }
+}
+
+#if defined(FAKER_CXX_HAS_X86_KERNELS)
+__attribute__((target("avx2"))) inline __m256i rotateLeftAvx2(__m256i value, int shift)
+{
+    return _mm256_or_si256(_mm256_slli_epi64(value, shift), _mm256_srli_epi64(value, 64 - shift));
+}
+
+__attribute__((target("avx2"))) inline __m256i load256(const std::uint64_t* source)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+}
+
+__attribute__((target("avx2"))) inline void store256(std::uint64_t* destination, __m256i value)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), value);
+}
+
+__attribute__((target("avx2"))) inline __m256i stepAvx2(__m256i& s0, __m256i& s1, __m256i& s2, __m256i& s3)
+{
+    const __m256i timesFive = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+    const __m256i rotated = rotateLeftAvx2(timesFive, 7);
+    const __m256i result = _mm256_add_epi64(_mm256_slli_epi64(rotated, 3), rotated);
+    const __m256i shifted = _mm256_slli_epi64(s1, 17);
+
+    s2 = _mm256_xor_si256(s2, s0);
+    s3 = _mm256_xor_si256(s3, s1);
+    s1 = _mm256_xor_si256(s1, s2);
+    s0 = _mm256_xor_si256(s0, s3);
+    s2 = _mm256_xor_si256(s2, shifted);
+    s3 = rotateLeftAvx2(s3, 45);
+
+    return result;
+}
+
+__attribute__((target("avx2"))) void fillAvx2(LaneEngine::State& state, std::uint64_t* out, std::size_t blocks)
+{
+    // Lanes 0-3 and 4-7 are kept in two independent register sets for instruction level parallelism.
+    __m256i lowS0 = load256(state[0].data());
+    __m256i lowS1 = load256(state[1].data());
+    __m256i lowS2 = load256(state[2].data());
+    __m256i lowS3 = load256(state[3].data());
+    __m256i highS0 = load256(state[0].data() + 4);
+    __m256i highS1 = load256(state[1].data() + 4);
+    __m256i highS2 = load256(state[2].data() + 4);
+    __m256i highS3 = load256(state[3].data() + 4);
+
+    for (std::size_t block = 0; block < blocks; block++)
+    {
+        store256(out + block * laneCount, stepAvx2(lowS0, lowS1, lowS2, lowS3));
+        store256(out + block * laneCount + 4, stepAvx2(highS0, highS1, highS2, highS3));
+    }
+
+    store256(state[0].data(), lowS0);
+    store256(state[1].data(), lowS1);
+    store256(state[2].data(), lowS2);
+    store256(state[3].data(), lowS3);
+    store256(state[0].data() + 4, highS0);
+    store256(state[1].data() + 4, highS1);
+    store256(state[2].data() + 4, highS2);
+    store256(state[3].data() + 4, highS3);
+}
+
+// GCC's AVX-512 shift and rotate intrinsics start from an undefined vector, which optimized builds report as possibly
+// uninitialized.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+__attribute__((target("avx512f"))) void fillAvx512(LaneEngine::State& state, std::uint64_t* out, std::size_t blocks)
+{
+    __m512i s0 = _mm512_loadu_si512(state[0].data());
+    __m512i s1 = _mm512_loadu_si512(state[1].data());
+    __m512i s2 = _mm512_loadu_si512(state[2].data());
+    __m512i s3 = _mm512_loadu_si512(state[3].data());
+
+    for (std::size_t block = 0; block < blocks; block++)
+    {
+        const __m512i timesFive = _mm512_add_epi64(_mm512_slli_epi64(s1, 2), s1);
+        const __m512i rotated = _mm512_rol_epi64(timesFive, 7);
+        const __m512i result = _mm512_add_epi64(_mm512_slli_epi64(rotated, 3), rotated);
+        const __m512i shifted = _mm512_slli_epi64(s1, 17);
+
+        s2 = _mm512_xor_si512(s2, s0);
+        s3 = _mm512_xor_si512(s3, s1);
+        s1 = _mm512_xor_si512(s1, s2);
+        s0 = _mm512_xor_si512(s0, s3);
+        s2 = _mm512_xor_si512(s2, shifted);
+        s3 = _mm512_rol_epi64(s3, 45);
+
+        _mm512_storeu_si512(out + block * laneCount, result);
+    }
+
+    _mm512_storeu_si512(state[0].data(), s0);
+    _mm512_storeu_si512(state[1].data(), s1);
+    _mm512_storeu_si512(state[2].data(), s2);
+    _mm512_storeu_si512(state[3].data(), s3);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+void fillBlocks(LaneEngine::State& state, std::uint64_t* out, std::size_t blocks, InstructionSet instructionSet)
+{
+#if defined(FAKER_CXX_HAS_X86_KERNELS)
+    switch (instructionSet)
+    {
+    case InstructionSet::Avx512:
+        fillAvx512(state, out, blocks);
+        return;
+    case InstructionSet::Avx2:
+        fillAvx2(state, out, blocks);
+        return;
+    default:
+        break;
+    }
+#else
+    (void)instructionSet;
+#endif
+
+    fillScalar(state, out, blocks);
+}
+}
+
+void LaneEngine::seed(Xoshiro256StarStar generator)
+{
+    for (std::size_t lane = 0; lane < laneCount; lane++)
+    {
+        const auto& words = generator.state();
+
+        for (std::size_t word = 0; word < words.size(); word++)
+        {
+            state_[word][lane] = words[word];
+        }
+
+        generator.jump();
+    }
+}
+
+void LaneEngine::fill(std::span<std::uint64_t> words, InstructionSet instructionSet)
+{
+    const std::size_t blocks = words.size() / laneCount;
+
+    fillBlocks(state_, words.data(), blocks, instructionSet);
+
+    const std::size_t remaining = words.size() - blocks * laneCount;
+
+    if (remaining != 0)
+    {
+        std::array<std::uint64_t, laneCount> block{};
+
+        fillBlocks(state_, block.data(), 1, instructionSet);
+
+        std::copy_n(block.begin(), remaining, words.begin() + static_cast<std::ptrdiff_t>(blocks * laneCount));
+    }
+}
+
+const LaneEngine::State& LaneEngine::state() const
+{
+    return state_;
+}
+
+void LaneEngine::setState(const State& state)
+{
+    state_ = state;
+}
+
+bool LaneEngine::isSupported(InstructionSet instructionSet)
+{
+#if defined(FAKER_CXX_HAS_X86_KERNELS)
+    __builtin_cpu_init();
+#endif
+
+    switch (instructionSet)
+    {
+#if defined(FAKER_CXX_HAS_X86_KERNELS)
+    case InstructionSet::Avx512:
+        return __builtin_cpu_supports("avx512f");
+    case InstructionSet::Avx2:
+        return __builtin_cpu_supports("avx2");
+#endif
+    case InstructionSet::Scalar:
+        return true;
+    default:
+        return false;
+    }
+}
+
+InstructionSet LaneEngine::bestInstructionSet()
+{
+    for (const auto instructionSet : {InstructionSet::Avx512, InstructionSet::Avx2})
+    {
+        if (isSupported(instructionSet))
+        {
+            return instructionSet;
+        }
+    }
+
+    return InstructionSet::Scalar;
+}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "faker-cxx/Random.h"
+
+namespace faker::random
+{
+/**
+ * @brief Eight xoshiro256** generators stepped in lock step, the state is kept lane-major for SIMD loads.
+ *
+ * Every block of eight output words holds one word per lane, in lane order, whatever instruction set computed it.
+ */
+class LaneEngine
+{
+public:
+    static constexpr std::size_t laneCount = 8;
+
+    using State = std::array<std::array<std::uint64_t, laneCount>, 4>;
+
+    /**
+     * @brief Seeds lane `n` with the given generator advanced by `n` jumps, so the lanes never overlap.
+     */
+    void seed(Xoshiro256StarStar generator);
+
+    void fill(std::span<std::uint64_t> words, InstructionSet instructionSet);
+
+    const State& state() const;
+
+    void setState(const State& state);
+
+    static bool isSupported(InstructionSet instructionSet);
+
+    static InstructionSet bestInstructionSet();
+
+private:
+    alignas(64) State state_{};
+};
+}
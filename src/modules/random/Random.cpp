@@ -0,0 +1,395 @@
+#include "faker-cxx/Random.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "LaneEngine.h"
+
+#ifndef FAKER_CXX_DEFAULT_ENGINE
+#define FAKER_CXX_DEFAULT_ENGINE Xoshiro256StarStar
+#endif
+
+namespace faker::random
+{
+namespace
+{
+// Generation 0 means the library was not seeded and engines draw their seeds from std::random_device.
+std::atomic<std::uint64_t> seedGeneration{0};
+std::atomic<std::uint64_t> globalSeed{0};
+std::atomic<std::uint64_t> nextStream{1};
+std::atomic<bool> seeded{false};
+std::atomic<EngineType> globalEngineType{EngineType::FAKER_CXX_DEFAULT_ENGINE};
+std::atomic<InstructionSet> globalInstructionSet{LaneEngine::bestInstructionSet()};
+
+struct ThreadEngine
+{
+    Engine engine;
+    EntropyPool pool;
+    std::uint64_t generation{(std::numeric_limits<std::uint64_t>::max)()};
+    std::optional<std::uint64_t> pinnedStream;
+    LaneEngine lanes;
+    bool lanesSeeded{false};
+    unsigned recordDepth{0};
+};
+
+thread_local ThreadEngine threadEngine;
+
+constexpr std::uint8_t snapshotFormatVersion = 1;
+constexpr std::uint8_t snapshotLanesSeededFlag = 1;
+
+// Words of Engine::State used by each algorithm, the serialized form omits the unused ones.
+std::size_t engineStateWordCount(EngineType type)
+{
+    switch (type)
+    {
+    case EngineType::Wyrand:
+        return 1;
+    case EngineType::Philox4x32:
+        return 3;
+    default:
+        return 4;
+    }
+}
+
+void appendWord(std::vector<std::uint8_t>& bytes, std::uint64_t word)
+{
+    for (unsigned shift = 0; shift < 64; shift += 8)
+    {
+        bytes.push_back(static_cast<std::uint8_t>(word >> shift));
+    }
+}
+
+std::uint64_t readWord(std::span<const std::uint8_t>& bytes)
+{
+    if (bytes.size() < sizeof(std::uint64_t))
+    {
+        throw std::invalid_argument{"Serialized snapshot is truncated."};
+    }
+
+    std::uint64_t word = 0;
+
+    for (unsigned i = 0; i < sizeof(std::uint64_t); i++)
+    {
+        word |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+    }
+
+    bytes = bytes.subspan(sizeof(std::uint64_t));
+
+    return word;
+}
+
+void reseed(ThreadEngine& local, std::uint64_t generation, std::optional<std::uint64_t> stream = std::nullopt)
+{
+    local.generation = generation;
+    local.lanesSeeded = false;
+    local.pool.clear();
+
+    const auto type = globalEngineType.load(std::memory_order_relaxed);
+
+    if (!seeded.load(std::memory_order_relaxed))
+    {
+        std::random_device device;
+
+        const auto seedValue = (static_cast<std::uint64_t>(device()) << 32) | device();
+
+        local.engine = Engine{seedValue, type};
+
+        return;
+    }
+
+    if (!stream)
+    {
+        stream = local.pinnedStream ? *local.pinnedStream : nextStream.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    local.engine = Engine{globalSeed.load(std::memory_order_relaxed), *stream, type};
+}
+
+void startGeneration()
+{
+    nextStream.store(1, std::memory_order_relaxed);
+
+    const auto generation = seedGeneration.fetch_add(1, std::memory_order_release) + 1;
+
+    auto& local = threadEngine;
+
+    reseed(local, generation, local.pinnedStream ? *local.pinnedStream : 0);
+}
+}
+
+Engine& engine()
+{
+    auto& local = threadEngine;
+
+    const auto generation = seedGeneration.load(std::memory_order_acquire);
+
+    // A record context owns the engine until its scope ends, reseeding is deferred to the first draw after it.
+    if (local.generation != generation && local.recordDepth == 0)
+    {
+        reseed(local, generation);
+    }
+
+    return local.engine;
+}
+
+EntropyPool& entropyPool()
+{
+    // Reseeds the thread first when needed, which empties a pool filled under a previous seed.
+    engine();
+
+    return threadEngine.pool;
+}
+
+void setSeed(std::uint64_t seed)
+{
+    globalSeed.store(seed, std::memory_order_relaxed);
+    seeded.store(true, std::memory_order_relaxed);
+
+    startGeneration();
+}
+
+void setStream(std::uint64_t stream)
+{
+    auto& local = threadEngine;
+
+    local.pinnedStream = stream;
+
+    const auto generation = seedGeneration.load(std::memory_order_acquire);
+
+    if (seeded.load(std::memory_order_relaxed))
+    {
+        reseed(local, generation, stream);
+    }
+}
+
+void setEngineType(EngineType type)
+{
+    globalEngineType.store(type, std::memory_order_relaxed);
+
+    startGeneration();
+}
+
+EngineType engineType()
+{
+    return globalEngineType.load(std::memory_order_relaxed);
+}
+
+void fill(std::span<std::uint64_t> words)
+{
+    auto& generator = engine();
+    auto& local = threadEngine;
+
+    // Record contexts must not depend on lane state shared with other records.
+    if (local.recordDepth != 0)
+    {
+        std::generate(words.begin(), words.end(), [&generator] { return generator(); });
+
+        return;
+    }
+
+    if (!local.lanesSeeded)
+    {
+        local.lanes.seed(Xoshiro256StarStar{generator()});
+        local.lanesSeeded = true;
+    }
+
+    local.lanes.fill(words, globalInstructionSet.load(std::memory_order_relaxed));
+}
+
+void fillBytes(std::span<std::uint8_t> bytes)
+{
+    std::array<std::uint64_t, WordBuffer::capacity> words;
+
+    while (!bytes.empty())
+    {
+        const std::size_t byteCount = (std::min)(bytes.size(), words.size() * sizeof(std::uint64_t));
+        const std::size_t wordCount = (byteCount + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+        fill(std::span<std::uint64_t>{words.data(), wordCount});
+
+        std::memcpy(bytes.data(), words.data(), byteCount);
+
+        bytes = bytes.subspan(byteCount);
+    }
+}
+
+InstructionSet instructionSet()
+{
+    return globalInstructionSet.load(std::memory_order_relaxed);
+}
+
+bool isSupported(InstructionSet instructionSet)
+{
+    return LaneEngine::isSupported(instructionSet);
+}
+
+void setInstructionSet(InstructionSet instructionSet)
+{
+    if (!LaneEngine::isSupported(instructionSet))
+    {
+        throw std::invalid_argument{"Instruction set is not supported by this CPU."};
+    }
+
+    globalInstructionSet.store(instructionSet, std::memory_order_relaxed);
+}
+
+RecordScope::RecordScope(std::uint64_t seed, std::uint64_t recordIndex)
+    : previousEngine_{engine()}, previousPool_{threadEngine.pool}
+{
+    auto& local = threadEngine;
+
+    // The record index fills the whole 64-bit stream counter, so every index gets its own stream.
+    Philox4x32 recordEngine{seed};
+    recordEngine.setState(recordEngine.key(), recordIndex, 0);
+
+    local.engine = Engine{recordEngine};
+    local.pool.clear();
+    local.recordDepth++;
+}
+
+RecordScope::RecordScope(std::uint64_t recordIndex)
+    : RecordScope{seeded.load(std::memory_order_relaxed) ? globalSeed.load(std::memory_order_relaxed) : 0,
+                  recordIndex}
+{
+}
+
+RecordScope::~RecordScope()
+{
+    auto& local = threadEngine;
+
+    local.engine = previousEngine_;
+    local.pool = previousPool_;
+    local.recordDepth--;
+}
+
+Snapshot snapshot()
+{
+    const auto& generator = engine();
+    const auto& local = threadEngine;
+
+    Snapshot snapshot;
+
+    snapshot.engineType_ = generator.type();
+    snapshot.engineState_ = generator.state();
+    snapshot.pool_ = local.pool;
+    snapshot.lanesSeeded_ = local.lanesSeeded;
+
+    if (local.lanesSeeded)
+    {
+        const auto& laneState = local.lanes.state();
+
+        for (std::size_t word = 0; word < laneState.size(); word++)
+        {
+            std::ranges::copy(laneState[word], snapshot.laneState_.begin() +
+                                                   static_cast<std::ptrdiff_t>(word * LaneEngine::laneCount));
+        }
+    }
+
+    return snapshot;
+}
+
+void restore(const Snapshot& snapshot)
+{
+    auto& local = threadEngine;
+
+    // Marks the thread as up to date, so the restored engine is not replaced by a pending reseed.
+    local.generation = seedGeneration.load(std::memory_order_acquire);
+
+    local.engine = Engine{};
+    local.engine.setState(snapshot.engineType_, snapshot.engineState_);
+    local.pool = snapshot.pool_;
+    local.lanesSeeded = snapshot.lanesSeeded_;
+
+    if (snapshot.lanesSeeded_)
+    {
+        LaneEngine::State laneState;
+
+        for (std::size_t word = 0; word < laneState.size(); word++)
+        {
+            std::copy_n(snapshot.laneState_.begin() + static_cast<std::ptrdiff_t>(word * LaneEngine::laneCount),
+                        LaneEngine::laneCount, laneState[word].begin());
+        }
+
+        local.lanes.setState(laneState);
+    }
+}
+
+std::vector<std::uint8_t> Snapshot::serialize() const
+{
+    std::vector<std::uint8_t> bytes{snapshotFormatVersion, static_cast<std::uint8_t>(engineType_),
+                                    static_cast<std::uint8_t>(lanesSeeded_ ? snapshotLanesSeededFlag : 0),
+                                    static_cast<std::uint8_t>(pool_.available())};
+
+    for (std::size_t word = 0; word < engineStateWordCount(engineType_); word++)
+    {
+        appendWord(bytes, engineState_[word]);
+    }
+
+    appendWord(bytes, pool_.buffer());
+
+    if (lanesSeeded_)
+    {
+        for (const auto word : laneState_)
+        {
+            appendWord(bytes, word);
+        }
+    }
+
+    return bytes;
+}
+
+Snapshot Snapshot::deserialize(std::span<const std::uint8_t> bytes)
+{
+    if (bytes.size() < 4 || bytes[0] != snapshotFormatVersion)
+    {
+        throw std::invalid_argument{"Unsupported serialized snapshot format."};
+    }
+
+    if (bytes[1] > static_cast<std::uint8_t>(EngineType::Philox4x32) || (bytes[2] & ~snapshotLanesSeededFlag) != 0 ||
+        bytes[3] > 64)
+    {
+        throw std::invalid_argument{"Serialized snapshot is corrupted."};
+    }
+
+    Snapshot snapshot;
+
+    snapshot.engineType_ = static_cast<EngineType>(bytes[1]);
+    snapshot.lanesSeeded_ = bytes[2] == snapshotLanesSeededFlag;
+
+    const unsigned poolAvailable = bytes[3];
+
+    bytes = bytes.subspan(4);
+
+    for (std::size_t word = 0; word < engineStateWordCount(snapshot.engineType_); word++)
+    {
+        snapshot.engineState_[word] = readWord(bytes);
+    }
+
+    snapshot.pool_.setState(readWord(bytes), poolAvailable);
+
+    if (snapshot.lanesSeeded_)
+    {
+        for (auto& word : snapshot.laneState_)
+        {
+            word = readWord(bytes);
+        }
+    }
+
+    if (!bytes.empty())
+    {
+        throw std::invalid_argument{"Serialized snapshot has trailing bytes."};
+    }
+
+    return snapshot;
+}
+}
@@ -0,0 +1,341 @@
+#include "RandomCharacters.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "faker-cxx/Random.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define FAKER_CXX_HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace faker::string
+{
+namespace
+{
+// Random words requested from the thread's lanes at a time.
+constexpr std::size_t batchWords = 64;
+
+constexpr std::size_t drawsPerWord = 4;
+
+// Largest set mapped with table lookups, larger sets are indexed directly.
+constexpr std::size_t maxTableSize = 256;
+
+// Shorter outputs draw from the thread's entropy pool, a batch of lane words costs more than it saves for them.
+// Pool nibbles are cheap, so the nibble kernel only pays off for longer outputs than the multiply-shift one.
+constexpr std::size_t minBatchedNibbles = 64;
+constexpr std::size_t minBatchedDraws = 8;
+
+bool useAvx2()
+{
+#if defined(FAKER_CXX_HAS_X86_KERNELS)
+    return random::instructionSet() != random::InstructionSet::Scalar;
+#else
+    return false;
+#endif
+}
+
+// Entry i holds characters[i % size], which is uniform over the set when its size divides 16.
+using NibbleTable = std::array<char, 16>;
+
+void mapNibblesScalar(const std::uint8_t* bytes, std::size_t byteCount, char* out, const NibbleTable& table)
+{
+    for (std::size_t i = 0; i < byteCount; i++)
+    {
+        out[2 * i] = table[bytes[i] & 0x0F];
+        out[2 * i + 1] = table[bytes[i] >> 4];
+    }
+}
+
+// Multiply-shift maps a 16-bit draw r to (r * size) >> 16, the draws whose low product half falls below
+// 65536 % size are rejected so every character has the same number of preimages.
+struct UniformTable
+{
+    std::string_view characters;
+    std::uint32_t size;
+    std::uint32_t threshold;
+};
+
+// Draws are the 16-bit quarters of each word from the lowest up, which is their memory order for the SIMD loads.
+std::uint32_t drawAt(const std::uint64_t* words, std::size_t index)
+{
+    return static_cast<std::uint16_t>(words[index / drawsPerWord] >> (16 * (index % drawsPerWord)));
+}
+
+// Maps the draws [first, last) in order until out is full, returns the number of characters written.
+std::size_t mapUniformScalar(const std::uint64_t* words, std::size_t first, std::size_t last, std::span<char> out,
+                             const UniformTable& table)
+{
+    std::size_t written = 0;
+
+    for (std::size_t i = first; i < last && written < out.size(); i++)
+    {
+        const std::uint32_t product = drawAt(words, i) * table.size;
+
+        if ((product & 0xFFFF) >= table.threshold)
+        {
+            out[written++] = table.characters[product >> 16];
+        }
+    }
+
+    return written;
+}
+
+#if defined(FAKER_CXX_HAS_X86_KERNELS)
+__attribute__((target("avx2"))) void mapNibblesAvx2(const std::uint8_t* bytes, std::size_t byteCount, char* out,
+                                                    const NibbleTable& table)
+{
+    const __m128i lookup = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.data()));
+    const __m128i lowMask = _mm_set1_epi8(0x0F);
+
+    std::size_t i = 0;
+
+    for (; i + 16 <= byteCount; i += 16)
+    {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        const __m128i low = _mm_and_si128(value, lowMask);
+        const __m128i high = _mm_and_si128(_mm_srli_epi16(value, 4), lowMask);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i),
+                         _mm_shuffle_epi8(lookup, _mm_unpacklo_epi8(low, high)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16),
+                         _mm_shuffle_epi8(lookup, _mm_unpackhi_epi8(low, high)));
+    }
+
+    mapNibblesScalar(bytes + i, byteCount - i, out + 2 * i, table);
+}
+
+// Looks up 16 byte indices in a table of up to 256 characters split into 16-entry pshufb tables, an index only
+// picks up the entry of the table whose range contains it.
+__attribute__((target("avx2"))) inline __m128i lookupAvx2(__m128i indices, const __m128i* tables,
+                                                          std::size_t tableCount)
+{
+    const __m128i lastEntry = _mm_set1_epi8(15);
+
+    __m128i result = _mm_setzero_si128();
+
+    for (std::size_t table = 0; table < tableCount; table++)
+    {
+        const __m128i offset = _mm_sub_epi8(indices, _mm_set1_epi8(static_cast<char>(table * 16)));
+        const __m128i inTable = _mm_cmpeq_epi8(_mm_min_epu8(offset, lastEntry), offset);
+
+        result = _mm_or_si128(result, _mm_and_si128(inTable, _mm_shuffle_epi8(tables[table], offset)));
+    }
+
+    return result;
+}
+
+__attribute__((target("avx2"))) std::size_t mapUniformAvx2(const std::uint64_t* words, std::size_t drawCount,
+                                                           std::span<char> out, const UniformTable& table)
+{
+    if (out.size() < 16)
+    {
+        return mapUniformScalar(words, 0, drawCount, out, table);
+    }
+
+    const std::size_t tableCount = (table.size + 15) / 16;
+
+    // Entries past the set are never selected, they are only cleared so no indeterminate bytes are loaded.
+    alignas(16) std::array<char, maxTableSize> padded;
+
+    std::fill(std::ranges::copy(table.characters, padded.begin()).out, padded.begin() + 16 * tableCount, '\0');
+
+    // A plain array, std::array drops the vector type's alignment attributes.
+    __m128i tables[maxTableSize / 16];
+
+    for (std::size_t i = 0; i < tableCount; i++)
+    {
+        tables[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(padded.data() + 16 * i));
+    }
+
+    const __m256i size = _mm256_set1_epi16(static_cast<short>(table.size));
+    const __m256i threshold = _mm256_set1_epi16(static_cast<short>(table.threshold));
+
+    std::size_t consumed = 0;
+    std::size_t written = 0;
+
+    while (consumed + 16 <= drawCount && written + 16 <= out.size())
+    {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + consumed / drawsPerWord));
+        const __m256i low = _mm256_mullo_epi16(value, size);
+        const __m256i accepted = _mm256_cmpeq_epi16(_mm256_max_epu16(low, threshold), low);
+
+        // A rejected draw shifts the following characters, such rare blocks are mapped one draw at a time.
+        if (_mm256_movemask_epi8(accepted) != -1)
+        {
+            written += mapUniformScalar(words, consumed, consumed + 16, out.subspan(written), table);
+            consumed += 16;
+
+            continue;
+        }
+
+        const __m256i indices = _mm256_mulhi_epu16(value, size);
+        const __m128i packed =
+            _mm_packus_epi16(_mm256_castsi256_si128(indices), _mm256_extracti128_si256(indices, 1));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + written),
+                         lookupAvx2(packed, tables, tableCount));
+
+        consumed += 16;
+        written += 16;
+    }
+
+    return written + mapUniformScalar(words, consumed, drawCount, out.subspan(written), table);
+}
+#endif
+
+void fillNibbles(std::span<char> out, std::string_view characters)
+{
+    NibbleTable table;
+
+    for (std::size_t i = 0; i < table.size(); i++)
+    {
+        table[i] = characters[i % characters.size()];
+    }
+
+    [[maybe_unused]] const bool avx2 = useAvx2();
+
+    std::array<std::uint64_t, batchWords> words;
+
+    // Bytes of the words are read in memory order, so the scalar and SIMD kernels slice the same nibbles.
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(words.data());
+
+    while (!out.empty())
+    {
+        const std::size_t count = (std::min)(out.size(), 2 * sizeof(words));
+        const std::size_t pairs = count / 2;
+        const std::size_t wordCount = ((count + 1) / 2 + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+        random::fill(std::span<std::uint64_t>{words.data(), wordCount});
+
+#if defined(FAKER_CXX_HAS_X86_KERNELS)
+        if (avx2)
+        {
+            mapNibblesAvx2(bytes, pairs, out.data(), table);
+        }
+        else
+#endif
+        {
+            mapNibblesScalar(bytes, pairs, out.data(), table);
+        }
+
+        if (count % 2 != 0)
+        {
+            out[count - 1] = table[bytes[pairs] & 0x0F];
+        }
+
+        out = out.subspan(count);
+    }
+}
+
+void fillUniform(std::span<char> out, std::string_view characters)
+{
+    const auto size = static_cast<std::uint32_t>(characters.size());
+
+    const UniformTable table{characters, size, (1u << 16) % size};
+
+    [[maybe_unused]] const bool avx2 = useAvx2() && characters.size() <= maxTableSize;
+
+    std::array<std::uint64_t, batchWords> words;
+
+    while (!out.empty())
+    {
+        const std::size_t wordCount = (std::min)((out.size() + drawsPerWord - 1) / drawsPerWord, words.size());
+        const std::size_t drawCount = wordCount * drawsPerWord;
+
+        random::fill(std::span<std::uint64_t>{words.data(), wordCount});
+
+        std::size_t written;
+
+#if defined(FAKER_CXX_HAS_X86_KERNELS)
+        if (avx2)
+        {
+            written = mapUniformAvx2(words.data(), drawCount, out, table);
+        }
+        else
+#endif
+        {
+            written = mapUniformScalar(words.data(), 0, drawCount, out, table);
+        }
+
+        out = out.subspan(written);
+    }
+}
+
+// Same draws as EntropyPool::uniform, with the bit width and rejection threshold computed once for the whole output.
+void fillFromPool(std::span<char> out, std::string_view characters)
+{
+    auto& pool = random::entropyPool();
+
+    const std::uint64_t size = characters.size();
+
+    if (std::has_single_bit(size))
+    {
+        const auto width = static_cast<unsigned>(std::countr_zero(size));
+
+        for (auto& character : out)
+        {
+            character = characters[pool.bits(width)];
+        }
+
+        return;
+    }
+
+    const auto width = static_cast<unsigned>(std::bit_width(size)) + 4;
+
+    if (width > 32)
+    {
+        for (auto& character : out)
+        {
+            character = characters[pool.uniform(size)];
+        }
+
+        return;
+    }
+
+    const auto mask = (std::uint64_t{1} << width) - 1;
+    const auto threshold = (mask + 1) % size;
+
+    for (auto& character : out)
+    {
+        auto product = pool.bits(width) * size;
+
+        while ((product & mask) < threshold)
+        {
+            product = pool.bits(width) * size;
+        }
+
+        character = characters[product >> width];
+    }
+}
+}
+
+void fillRandomCharacters(std::span<char> out, std::string_view characters)
+{
+    if (out.empty())
+    {
+        return;
+    }
+
+    const bool nibbles = characters.size() <= 16 && std::has_single_bit(characters.size());
+
+    if (nibbles && out.size() >= minBatchedNibbles)
+    {
+        fillNibbles(out, characters);
+    }
+    else if (!nibbles && out.size() >= minBatchedDraws && characters.size() <= (1u << 16))
+    {
+        fillUniform(out, characters);
+    }
+    else
+    {
+        fillFromPool(out, characters);
+    }
+}
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <span>
+#include <string_view>
+
+namespace faker::string
+{
+/**
+ * @brief Fills out with characters drawn uniformly from characters, which must not be empty.
+ *
+ * All but short outputs are mapped from batches of random words: sets whose size is a power of two up to 16 take one
+ * character from every four random bits, any other set maps random 16-bit values with a multiply-shift and rejects
+ * the few values that would bias the draw. Sets of up to 256 characters are mapped with AVX2 table lookups when
+ * `random::instructionSet()` selects AVX2 or AVX-512, the output for a seed does not depend on the instruction set.
+ * Short outputs draw each character from the thread's entropy pool.
+ */
+void fillRandomCharacters(std::span<char> out, std::string_view characters);
+}
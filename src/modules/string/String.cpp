@@ -1,105 +1,143 @@
 #include "faker-cxx/String.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
-#include <map>
+#include <cstddef>
+#include <iterator>
+#include <limits>
 #include <optional>
 #include <set>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 #include "common/FormatHelper.h"
 #include "common/AlgoHelper.h"
 #include "faker-cxx/Helper.h"
 #include "faker-cxx/Number.h"
+#include "faker-cxx/Random.h"
 #include "faker-cxx/types/Hex.h"
+#include "RandomCharacters.h"
 #include "StringData.h"
 
 namespace faker::string
 {
 namespace
 {
-const std::map<StringCasing, std::string> stringCasingToAlphaCharactersMapping{
-    {StringCasing::Lower, lowerCharacters},
-    {StringCasing::Upper, upperCharacters},
-    {StringCasing::Mixed, mixedAlphaCharacters},
-};
-const std::map<StringCasing, std::string> stringCasingToAlphanumericCharactersMapping{
-    {StringCasing::Lower, lowerAlphanumericCharacters},
-    {StringCasing::Upper, upperAlphanumericCharacters},
-    {StringCasing::Mixed, mixedAlphanumericCharacters},
-};
-const std::map<HexCasing, std::string> hexCasingToCharactersMapping{
-    {HexCasing::Lower, hexLowerCharacters},
-    {HexCasing::Upper, hexUpperCharacters},
-};
-const std::map<HexPrefix, std::string> hexPrefixToStringMapping{
-    {HexPrefix::ZeroX, "0x"},
-    {HexPrefix::Hash, "#"},
-    {HexPrefix::None, ""},
-};
-
-const std::map<StringCasing, std::set<char>> stringCasingToAlphaCharSetMapping{
-    {StringCasing::Lower, lowerCharSet},
-    {StringCasing::Upper, upperCharSet},
-    {StringCasing::Mixed, mixedAlphaCharSet},
-};
-
-const std::map<HexCasing, std::set<char>> hexCasingToCharSetMapping{
-    {HexCasing::Lower, hexLowerCharSet},
-    {HexCasing::Upper, hexUpperCharSet},
-};
-
-std::string generateStringWithGuarantee(GuaranteeMap& guarantee, std::set<char>& targetCharacters, unsigned int length)
+std::string_view alphaCharacters(StringCasing casing)
 {
-    std::string output{};
-    output += generateAtLeastString(guarantee);
-    // string with least required chars cannot be greater than the total length
-    assert(output.size() <= length);
-    // we will generate chars for remaining length only
-    length -= static_cast<unsigned>(output.size());
-    for (unsigned i = 0; i < length; ++i)
+    switch (casing)
     {
-        char generatedChar;
-        // generate chars till we find a usable char
-        while (true)
-        {
-            // pick random char from targetCharacters
-            generatedChar = helper::setElement(targetCharacters);
-
-            auto it = guarantee.find(generatedChar);
-            // if no constraint on generated char, break out of loop
-            if (it == guarantee.end())
-                break;
-            auto remainingUses = it->second.atMostCount - it->second.atLeastCount;
-            if (remainingUses > 0)
-            {
-                // decrement no of possible uses as we will use it right now
-                --it->second.atMostCount;
-                break;
-            }
-            // remove this char from targetCharacters as it is no longer valid and regenerate char
-            else
-            {
-                targetCharacters.erase(it->first);
-            }
-        }
-        output += generatedChar;
+    case StringCasing::Lower:
+        return lowerCharacters;
+    case StringCasing::Upper:
+        return upperCharacters;
+    default:
+        return mixedAlphaCharacters;
     }
-    // shuffle the generated string as the atleast string generated earlier was not generated randomly
-    output = helper::shuffleString(output);
-    return output;
 }
+
+std::string_view alphanumericCharacters(StringCasing casing)
+{
+    switch (casing)
+    {
+    case StringCasing::Lower:
+        return lowerAlphanumericCharacters;
+    case StringCasing::Upper:
+        return upperAlphanumericCharacters;
+    default:
+        return mixedAlphanumericCharacters;
+    }
 }
 
-bool isValidGuarantee(GuaranteeMap& guarantee, std::set<char>& targetCharacters, unsigned int length)
+CharSet alphaCharSet(StringCasing casing)
+{
+    switch (casing)
+    {
+    case StringCasing::Lower:
+        return lowerCharSet;
+    case StringCasing::Upper:
+        return upperCharSet;
+    default:
+        return mixedAlphaCharSet;
+    }
+}
+
+std::string_view hexCharacters(HexCasing casing)
+{
+    return casing == HexCasing::Upper ? hexUpperCharacters : hexLowerCharacters;
+}
+
+CharSet hexCharSet(HexCasing casing)
+{
+    return casing == HexCasing::Upper ? hexUpperCharSet : hexLowerCharSet;
+}
+
+// Fills out with characters drawn uniformly from the dense table characters.
+void fillFromCharacters(std::span<char> out, std::string_view characters)
+{
+    if (out.empty())
+    {
+        return;
+    }
+
+    if (characters.empty())
+    {
+        throw std::invalid_argument{"Data is empty."};
+    }
+
+    fillRandomCharacters(out, characters);
+}
+
+void fillFromCharactersExcluding(std::span<char> out, std::string_view characters, const std::string& excludeCharacters)
+{
+    if (excludeCharacters.empty())
+    {
+        fillFromCharacters(out, characters);
+
+        return;
+    }
+
+    const CharSet excluded{excludeCharacters};
+
+    std::string targetCharacters;
+
+    std::ranges::copy_if(characters, std::back_inserter(targetCharacters),
+                         [&excluded](char character) { return !excluded.contains(character); });
+
+    fillFromCharacters(out, targetCharacters);
+}
+
+// Grows out by count characters and lets fill write them in place, out keeps its previous contents if fill throws.
+template <class Fill>
+void appendWith(std::string& out, std::size_t count, Fill fill)
+{
+    const auto previousSize = out.size();
+
+    out.resize(previousSize + count);
+
+    try
+    {
+        fill(std::span<char>{out}.subspan(previousSize));
+    }
+    catch (...)
+    {
+        out.resize(previousSize);
+
+        throw;
+    }
+}
+
+bool isValidGuarantee(const GuaranteeMap& guarantee, const CharSet& targetCharacters, unsigned int length)
 {
     unsigned int atleastCountSum{};
     unsigned int atmostCountSum{};
-    for (auto& it : guarantee)
+    for (const auto& it : guarantee)
     {
         // if a char in guarantee is not in char set, it is an invalid guarantee
-        if (std::find(targetCharacters.begin(), targetCharacters.end(), it.first) == targetCharacters.end())
+        if (!targetCharacters.contains(it.first))
         {
             return false;
         }
@@ -114,6 +152,73 @@ bool isValidGuarantee(GuaranteeMap& guarantee, std::set<char>& targetCharacters,
     return true;
 }
 
+// Draws every free character uniformly from the characters with uses left, a character is dropped from the dense
+// table once its last use is drawn, so the output takes a single O(length) pass without retries.
+std::string generateStringWithGuarantee(const GuaranteeMap& guarantee, const CharSet& targetCharacters,
+                                        unsigned int length)
+{
+    constexpr auto unlimitedUses = (std::numeric_limits<unsigned>::max)();
+
+    std::string output{};
+    output.reserve(length);
+    output += generateAtLeastString(guarantee);
+    // string with least required chars cannot be greater than the total length
+    assert(output.size() <= length);
+
+    std::array<char, 256> available;
+    std::array<unsigned, 256> remainingUses;
+    std::size_t availableCount = 0;
+
+    for (const auto character : targetCharacters.characters())
+    {
+        const auto it = guarantee.find(character);
+        const auto uses = it == guarantee.end() ? unlimitedUses : it->second.atMostCount - it->second.atLeastCount;
+
+        if (uses > 0)
+        {
+            remainingUses[static_cast<unsigned char>(character)] = uses;
+            available[availableCount++] = character;
+        }
+    }
+
+    auto& pool = random::entropyPool();
+
+    for (auto i = output.size(); i < length; ++i)
+    {
+        if (availableCount == 0)
+        {
+            throw std::invalid_argument{"Invalid guarantee."};
+        }
+
+        const auto index = pool.uniform(availableCount);
+        const auto character = available[index];
+        auto& uses = remainingUses[static_cast<unsigned char>(character)];
+
+        output += character;
+
+        if (uses != unlimitedUses && --uses == 0)
+        {
+            available[index] = available[--availableCount];
+        }
+    }
+    // shuffle the generated string as the atleast string generated earlier was not generated randomly
+    output = helper::shuffleString(output);
+    return output;
+}
+}
+
+bool isValidGuarantee(GuaranteeMap& guarantee, std::set<char>& targetCharacters, unsigned int length)
+{
+    CharSet charSet;
+
+    for (const auto character : targetCharacters)
+    {
+        charSet.insert(character);
+    }
+
+    return isValidGuarantee(guarantee, charSet, length);
+}
+
 std::string generateAtLeastString(const GuaranteeMap& guarantee)
 {
     std::string result;
@@ -126,19 +231,16 @@ std::string generateAtLeastString(const GuaranteeMap& guarantee)
 
 std::string sample(unsigned int length)
 {
-    std::string sample;
+    std::string sample(length, '\0');
 
-    for (unsigned i = 0; i < length; i++)
-    {
-        sample += static_cast<char>(number::integer(33, 125));
-    }
+    fillRandomCharacters(sample, sampleCharacters);
 
     return sample;
 }
 
 std::string sample(GuaranteeMap&& guarantee, unsigned int length)
 {
-    auto targetCharacters = utf16CharSet;
+    const auto& targetCharacters = utf16CharSet;
     // throw if guarantee is invalid
     if (!isValidGuarantee(guarantee, targetCharacters, length))
     {
@@ -151,21 +253,24 @@ std::string fromCharacters(const std::string& characters, unsigned int length)
 {
     std::string result;
 
-    for (unsigned i = 0; i < length; i++)
-    {
-        result += helper::arrayElement<char>(characters);
-    }
+    fromCharacters(result, characters, length);
 
     return result;
 }
 
+void fromCharacters(std::span<char> out, std::string_view characters)
+{
+    fillFromCharacters(out, characters);
+}
+
+void fromCharacters(std::string& out, std::string_view characters, unsigned length)
+{
+    appendWith(out, length, [characters](std::span<char> part) { fillFromCharacters(part, characters); });
+}
+
 std::string fromCharacters(GuaranteeMap&& guarantee, const std::string& characters, unsigned length)
 {
-    std::set<char> targetCharacters;
-    for (auto character : characters)
-    {
-        targetCharacters.insert(character);
-    }
+    const CharSet targetCharacters{characters};
     // throw if guarantee is invalid
     if (!isValidGuarantee(guarantee, targetCharacters, length))
     {
@@ -176,31 +281,27 @@ std::string fromCharacters(GuaranteeMap&& guarantee, const std::string& characte
 
 std::string alpha(unsigned length, StringCasing casing, const std::string& excludeCharacters)
 {
-    const auto& alphaCharacters = stringCasingToAlphaCharactersMapping.at(casing);
+    std::string result;
 
-    std::string targetCharacters;
+    alpha(result, length, casing, excludeCharacters);
 
-    for (const auto& character : alphaCharacters)
-    {
-        if (excludeCharacters.find(character) == std::string::npos)
-        {
-            targetCharacters += character;
-        }
-    }
-
-    std::string alpha;
+    return result;
+}
 
-    for (unsigned i = 0; i < length; i++)
-    {
-        alpha += helper::arrayElement<char>(targetCharacters);
-    }
+void alpha(std::span<char> out, StringCasing casing, const std::string& excludeCharacters)
+{
+    fillFromCharactersExcluding(out, alphaCharacters(casing), excludeCharacters);
+}
 
-    return alpha;
+void alpha(std::string& out, unsigned length, StringCasing casing, const std::string& excludeCharacters)
+{
+    appendWith(out, length, [casing, &excludeCharacters](std::span<char> part)
+               { fillFromCharactersExcluding(part, alphaCharacters(casing), excludeCharacters); });
 }
 
 std::string alpha(GuaranteeMap&& guarantee, unsigned int length, StringCasing casing)
 {
-    auto targetCharacters = stringCasingToAlphaCharSetMapping.at(casing);
+    const auto targetCharacters = alphaCharSet(casing);
     // throw if guarantee is invalid
     if (!isValidGuarantee(guarantee, targetCharacters, length))
     {
@@ -211,33 +312,27 @@ std::string alpha(GuaranteeMap&& guarantee, unsigned int length, StringCasing ca
 
 std::string alphanumeric(unsigned int length, StringCasing casing, const std::string& excludeCharacters)
 {
-    const auto& alphanumericCharacters = stringCasingToAlphanumericCharactersMapping.at(casing);
-
-    std::string targetCharacters;
+    std::string result;
 
-    for (const auto& alphanumericCharacter : alphanumericCharacters)
-    {
-        if (excludeCharacters.find(alphanumericCharacter) == std::string::npos)
-        {
-            targetCharacters += alphanumericCharacter;
-        }
-    }
+    alphanumeric(result, length, casing, excludeCharacters);
 
-    std::string alphanumeric;
+    return result;
+}
 
-    for (unsigned i = 0; i < length; i++)
-    {
-        alphanumeric += helper::arrayElement<char>(targetCharacters);
-    }
+void alphanumeric(std::span<char> out, StringCasing casing, const std::string& excludeCharacters)
+{
+    fillFromCharactersExcluding(out, alphanumericCharacters(casing), excludeCharacters);
+}
 
-    return alphanumeric;
+void alphanumeric(std::string& out, unsigned length, StringCasing casing, const std::string& excludeCharacters)
+{
+    appendWith(out, length, [casing, &excludeCharacters](std::span<char> part)
+               { fillFromCharactersExcluding(part, alphanumericCharacters(casing), excludeCharacters); });
 }
 
 std::string alphanumeric(GuaranteeMap&& guarantee, unsigned length, StringCasing casing)
 {
-    auto targetCharacters = digitSet;
-    auto charSet = stringCasingToAlphaCharSetMapping.at(casing);
-    targetCharacters.merge(charSet);
+    const auto targetCharacters = digitSet | alphaCharSet(casing);
     // throw if guarantee is invalid
     if (!isValidGuarantee(guarantee, targetCharacters, length))
     {
@@ -248,21 +343,28 @@ std::string alphanumeric(GuaranteeMap&& guarantee, unsigned length, StringCasing
 
 std::string numeric(unsigned int length, bool allowLeadingZeros)
 {
-    std::string alphanumeric;
+    std::string numeric;
 
-    for (unsigned i = 0; i < length; i++)
+    string::numeric(numeric, length, allowLeadingZeros);
+
+    return numeric;
+}
+
+void numeric(std::span<char> out, bool allowLeadingZeros)
+{
+    if (!out.empty() && !allowLeadingZeros)
     {
-        if (i == 0 && allowLeadingZeros)
-        {
-            alphanumeric += helper::arrayElement<char>(numericCharacters);
-        }
-        else
-        {
-            alphanumeric += helper::arrayElement<char>(numericCharactersWithoutZero);
-        }
+        fillRandomCharacters(out.first(1), numericCharactersWithoutZero);
+
+        out = out.subspan(1);
     }
 
-    return alphanumeric;
+    fillRandomCharacters(out, numericCharacters);
+}
+
+void numeric(std::string& out, unsigned length, bool allowLeadingZeros)
+{
+    appendWith(out, length, [allowLeadingZeros](std::span<char> part) { numeric(part, allowLeadingZeros); });
 }
 
 std::string numeric(GuaranteeMap&& guarantee, const unsigned length, bool allowLeadingZeros)
@@ -276,7 +378,7 @@ std::string numeric(GuaranteeMap&& guarantee, const unsigned length, bool allowL
             throw std::invalid_argument{"Invalid guarantee."};
         }
     }
-    auto targetCharacters = digitSet;
+    const auto& targetCharacters = digitSet;
     // throw if guarantee is invalid
     if (!isValidGuarantee(guarantee, targetCharacters, length))
     {
@@ -300,18 +402,29 @@ std::string numeric(GuaranteeMap&& guarantee, const unsigned length, bool allowL
 
 std::string hexadecimal(unsigned int length, HexCasing casing, HexPrefix prefix)
 {
-    const auto& hexadecimalCharacters = hexCasingToCharactersMapping.at(casing);
+    std::string hexadecimal;
 
-    const auto& hexadecimalPrefix = hexPrefixToStringMapping.at(prefix);
+    string::hexadecimal(hexadecimal, length, casing, prefix);
 
-    std::string hexadecimal{hexadecimalPrefix};
+    return hexadecimal;
+}
 
-    for (unsigned i = 0; i < length; i++)
-    {
-        hexadecimal += helper::arrayElement<char>(hexadecimalCharacters);
-    }
+void hexadecimal(std::span<char> out, HexCasing casing)
+{
+    fillRandomCharacters(out, hexCharacters(casing));
+}
 
-    return hexadecimal;
+void hexadecimal(std::string& out, unsigned length, HexCasing casing, HexPrefix prefix)
+{
+    const auto hexadecimalPrefix = detail::hexPrefixText(prefix);
+
+    appendWith(out, hexadecimalPrefix.size() + length,
+               [hexadecimalPrefix, casing](std::span<char> part)
+               {
+                   std::ranges::copy(hexadecimalPrefix, part.begin());
+
+                   hexadecimal(part.subspan(hexadecimalPrefix.size()), casing);
+               });
 }
 
 std::string hexadecimal(std::optional<int> min, std::optional<int> max)
@@ -334,30 +447,41 @@ std::string hexadecimal(std::optional<int> min, std::optional<int> max)
 
 std::string hexadecimal(GuaranteeMap&& guarantee, unsigned int length, HexCasing casing, HexPrefix prefix)
 {
-    std::set<char> targetCharacters = hexCasingToCharSetMapping.at(casing);
+    const auto targetCharacters = hexCharSet(casing);
     // throw if guarantee is invalid
     if (!isValidGuarantee(guarantee, targetCharacters, length))
     {
         throw std::invalid_argument{"Invalid guarantee."};
     }
-    const auto& hexadecimalPrefix = hexPrefixToStringMapping.at(prefix);
-    return hexadecimalPrefix + generateStringWithGuarantee(guarantee, targetCharacters, length);
+    return std::string{detail::hexPrefixText(prefix)} +
+           generateStringWithGuarantee(guarantee, targetCharacters, length);
 }
 
 std::string binary(unsigned int length)
 {
     std::string binaryNumber;
-    for (unsigned int i = 0; i < length; ++i)
-    {
-        binaryNumber += static_cast<char>(number::integer(1));
-    }
-    return "0b" + binaryNumber;
+
+    binary(binaryNumber, length);
+
+    return binaryNumber;
+}
+
+void binary(std::span<char> out)
+{
+    fillRandomCharacters(out, "01");
+}
+
+void binary(std::string& out, unsigned length)
+{
+    out += "0b";
+
+    appendWith(out, length, [](std::span<char> part) { binary(part); });
 }
 
 std::string binary(GuaranteeMap&& guarantee, unsigned int length)
 {
     // numbers used by binary representation
-    std::set<char> targetCharacters{'0', '1'};
+    const auto& targetCharacters = binaryCharSet;
     // throw if guarantee is invalid
     if (!isValidGuarantee(guarantee, targetCharacters, length))
     {
@@ -370,17 +494,28 @@ std::string binary(GuaranteeMap&& guarantee, unsigned int length)
 std::string octal(unsigned int length)
 {
     std::string octalNumber;
-    for (unsigned int i = 0; i < length; ++i)
-    {
-        octalNumber += static_cast<char>(number::integer(7));
-    }
-    return "0o" + octalNumber;
+
+    octal(octalNumber, length);
+
+    return octalNumber;
+}
+
+void octal(std::span<char> out)
+{
+    fillRandomCharacters(out, "01234567");
+}
+
+void octal(std::string& out, unsigned length)
+{
+    out += "0o";
+
+    appendWith(out, length, [](std::span<char> part) { octal(part); });
 }
 
 std::string octal(GuaranteeMap&& guarantee, unsigned int length)
 {
     // numbers used by octal representation
-    std::set<char> targetCharacters{'0', '1', '2', '3', '4', '5', '6', '7'};
+    const auto& targetCharacters = octalCharSet;
     // throw if guarantee is invalid
     if (!isValidGuarantee(guarantee, targetCharacters, length))
     {
@@ -1,10 +1,116 @@
 #pragma once
 
-#include <set>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace faker::string
 {
+/**
+ * A set of bytes stored as a 256-bit bitmap, usable in constant expressions.
+ */
+class CharSet
+{
+public:
+    constexpr CharSet() = default;
+
+    constexpr explicit CharSet(std::string_view characters)
+    {
+        for (const auto character : characters)
+        {
+            insert(character);
+        }
+    }
+
+    static constexpr CharSet range(char first, char last)
+    {
+        CharSet charSet;
+
+        for (unsigned byte = static_cast<unsigned char>(first); byte <= static_cast<unsigned char>(last); byte++)
+        {
+            charSet.insert(static_cast<char>(byte));
+        }
+
+        return charSet;
+    }
+
+    constexpr void insert(char character)
+    {
+        const auto byte = static_cast<unsigned char>(character);
+
+        words_[byte / 64] |= std::uint64_t{1} << (byte % 64);
+    }
+
+    constexpr bool contains(char character) const
+    {
+        const auto byte = static_cast<unsigned char>(character);
+
+        return (words_[byte / 64] >> (byte % 64) & 1) != 0;
+    }
+
+    constexpr std::size_t size() const
+    {
+        std::size_t size = 0;
+
+        for (const auto word : words_)
+        {
+            size += static_cast<std::size_t>(std::popcount(word));
+        }
+
+        return size;
+    }
+
+    constexpr CharSet operator|(const CharSet& other) const
+    {
+        CharSet charSet;
+
+        for (std::size_t i = 0; i < words_.size(); i++)
+        {
+            charSet.words_[i] = words_[i] | other.words_[i];
+        }
+
+        return charSet;
+    }
+
+    constexpr CharSet operator-(const CharSet& other) const
+    {
+        CharSet charSet;
+
+        for (std::size_t i = 0; i < words_.size(); i++)
+        {
+            charSet.words_[i] = words_[i] & ~other.words_[i];
+        }
+
+        return charSet;
+    }
+
+    /**
+     * @returns The members in ascending byte order, a dense table to draw from.
+     */
+    std::string characters() const
+    {
+        std::string characters;
+
+        characters.reserve(size());
+
+        for (unsigned byte = 0; byte < 256; byte++)
+        {
+            if (contains(static_cast<char>(byte)))
+            {
+                characters += static_cast<char>(byte);
+            }
+        }
+
+        return characters;
+    }
+
+private:
+    std::array<std::uint64_t, 4> words_{};
+};
+
  const std::string upperCharacters{"ABCDEFGHIJKLMNOPQRSTUVWXYZ"};
  const std::string lowerCharacters{"abcdefghijklmnopqrstuvwxyz"};
  const std::string numericCharactersWithoutZero{"123456789"};
@@ -17,35 +123,15 @@ namespace faker::string
  const std::string hexLowerCharacters{"0123456789abcdef"};
  const std::string symbolCharacters{"~`!@#$%^&*()_-+={[}]|:;\"'<,>.?/"};
 
- const std::set<char> lowerCharSet{
-    'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
-    'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
-};
-
- const std::set<char> upperCharSet{
-    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
-    'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
-};
-
- const std::set<char> mixedAlphaCharSet{
-    'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r',
-    's', 't', 'u', 'v', 'w', 'x', 'y', 'z', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J',
-    'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
-};
-
- const std::set<char> hexUpperCharSet{'A', 'B', 'C', 'D', 'E', 'F', '0', '1',
-                                            '2', '3', '4', '5', '6', '7', '8', '9'};
-
- const std::set<char> hexLowerCharSet{'a', 'b', 'c', 'd', 'e', 'f', '0', '1',
-                                            '2', '3', '4', '5', '6', '7', '8', '9'};
-
- const std::set<char> digitSet{'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
-
- const std::set<char> utf16CharSet{
-    '!', '"', '#',  '$', '%', '&', '\'', '(', ')', '*', '+', ',', '-', '.', '/', '0', '1', '2', '3',
-    '4', '5', '6',  '7', '8', '9', ':',  ';', '<', '=', '>', '?', '@', 'A', 'B', 'C', 'D', 'E', 'F',
-    'G', 'H', 'I',  'J', 'K', 'L', 'M',  'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y',
-    'Z', '[', '\\', ']', '^', '_', '`',  'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l',
-    'm', 'n', 'o',  'p', 'q', 'r', 's',  't', 'u', 'v', 'w', 'x', 'y', 'z', '{', '|', '}',
-};
+ constexpr CharSet lowerCharSet{"abcdefghijklmnopqrstuvwxyz"};
+ constexpr CharSet upperCharSet{"ABCDEFGHIJKLMNOPQRSTUVWXYZ"};
+ constexpr CharSet mixedAlphaCharSet{lowerCharSet | upperCharSet};
+ constexpr CharSet digitSet{"0123456789"};
+ constexpr CharSet hexUpperCharSet{digitSet | CharSet{"ABCDEF"}};
+ constexpr CharSet hexLowerCharSet{digitSet | CharSet{"abcdef"}};
+ constexpr CharSet binaryCharSet{"01"};
+ constexpr CharSet octalCharSet{"01234567"};
+ // Printable ASCII from '!' to '}'.
+ constexpr CharSet utf16CharSet{CharSet::range('!', '}')};
+ const std::string sampleCharacters{utf16CharSet.characters()};
 }
@@ -1,8 +1,12 @@
 #include "faker-cxx/System.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -13,7 +17,10 @@
 #include "faker-cxx/Helper.h"
 #include "faker-cxx/Internet.h"
 #include "faker-cxx/Number.h"
+#include "faker-cxx/Random.h"
+#include "faker-cxx/Sampling.h"
 #include "faker-cxx/String.h"
+#include "faker-cxx/StringParts.h"
 #include "faker-cxx/Word.h"
 #include "SystemData.h"
 
@@ -42,6 +49,24 @@ std::string_view extension(std::string_view mimeType)
 
     return it->second;
 }
+
+// Extensions of all mime types without duplicates, in alphabetical order.
+const std::vector<std::string_view>& distinctExtensions()
+{
+    static const auto extensions = []
+    {
+        std::set<std::string_view> extensionSet;
+
+        for (const auto& mimeTypeName : mimeTypes)
+        {
+            extensionSet.insert(extension(mimeTypeName));
+        }
+
+        return std::vector<std::string_view>(extensionSet.begin(), extensionSet.end());
+    }();
+
+    return extensions;
+}
 }
 
 std::string fileName(const FileOptions& options)
@@ -52,28 +77,19 @@ std::string fileName(const FileOptions& options)
 
     if (options.extensionCount > 0)
     {
-        std::vector<std::string> randomExtensions;
+        const std::integral auto numExtensions =
+            options.extensionRange.min == options.extensionRange.max
+                ? options.extensionCount
+                : number::integer(options.extensionRange.min, options.extensionRange.max);
 
-        if (options.extensionRange.min == options.extensionRange.max)
-        {
-            for (int i = 0; i < options.extensionCount; ++i)
-            {
-                randomExtensions.push_back(fileExtension());
-            }
+        const auto& extensions = distinctExtensions();
 
-            extensionsStr = "." + common::joinString(randomExtensions, ".");
-        }
-        else
-        {
-            const std::integral auto numExtensions =
-                number::integer(options.extensionRange.min, options.extensionRange.max);
+        const auto count = std::min(static_cast<std::size_t>(std::max(numExtensions, 0)), extensions.size());
 
-            for (int i = 0; i < numExtensions; ++i)
-            {
-                randomExtensions.push_back(fileExtension());
-            }
-
-            extensionsStr = "." + common::joinString(randomExtensions, ".");
+        for (const auto& ext : helper::arrayElements(std::span<const std::string_view>{extensions}, count))
+        {
+            extensionsStr += ".";
+            extensionsStr += ext.get();
         }
     }
 
@@ -104,16 +120,7 @@ std::string fileExtension(const std::optional<FileType>& mimeType)
     }
     else
     {
-        std::set<std::string_view> extensionSet;
-
-        for (const auto& mimeTypeName : mimeTypes)
-        {
-            extensionSet.insert(extension(mimeTypeName));
-        }
-
-        std::vector<std::string> extensions(extensionSet.begin(), extensionSet.end());
-
-        return helper::arrayElement(extensions);
+        return std::string{helper::arrayElement(distinctExtensions())};
     }
 }
 
@@ -201,32 +208,38 @@ std::string networkInterface(const std::optional<NetworkInterfaceOptions>& optio
         }
     }
 
-    std::string suffix;
-    std::string prefix;
-    auto digit = []() { return string::numeric(); };
+    const std::string_view type = interfaceType;
+    const auto schema = commonInterfaceSchemas.at(interfaceSchema);
+    const auto digit = [](std::string& out) { out += static_cast<char>('0' + random::entropyPool().uniform(10)); };
+
+    std::string result;
 
     if (interfaceSchema == "index")
     {
-        suffix = digit();
+        helper::concat(type, schema, digit)(result);
     }
     else if (interfaceSchema == "slot")
     {
-        suffix = helper::maybe<std::string>([&]() { return "f" + digit(); });
-        suffix += helper::maybe<std::string>([&]() { return "d" + digit(); });
+        helper::concat(type, schema, helper::maybe(helper::concat("f", digit)),
+                       helper::maybe(helper::concat("d", digit)))(result);
     }
     else if (interfaceSchema == "mac")
     {
-        suffix = internet::mac("");
+        helper::concat(type, schema)(result);
+
+        result += internet::mac("");
     }
     else if (interfaceSchema == "pci")
     {
-        prefix = helper::maybe<std::string>([&]() { return "P" + digit(); });
-        suffix = digit() + "s" + digit();
-        suffix += helper::maybe<std::string>([&]() { return "f" + digit(); });
-        suffix += helper::maybe<std::string>([&]() { return "d" + digit(); });
+        helper::concat(helper::maybe(helper::concat("P", digit)), type, schema, digit, "s", digit,
+                       helper::maybe(helper::concat("f", digit)), helper::maybe(helper::concat("d", digit)))(result);
+    }
+    else
+    {
+        helper::concat(type, schema)(result);
     }
 
-    return prefix + interfaceType + std::string(commonInterfaceSchemas.at(interfaceSchema)) + suffix;
+    return result;
 }
 
 std::string cron(const CronOptions& options)
@@ -2,9 +2,13 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <iterator>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "faker-cxx/Helper.h"
 #include "WordData.h"
@@ -12,11 +16,15 @@
 namespace faker::word
 {
 template <typename It>
-auto sortedSizeArrayElement(std::optional<unsigned int> length, It start, It end) -> decltype(*std::declval<It>())
+auto sortedSizeArrayElement(std::optional<unsigned int> length, It start, It end, double skew = 0.)
+    -> decltype(*std::declval<It>())
 {
+    const auto element = [skew](It first, It last) -> decltype(*std::declval<It>())
+    { return skew == 0. ? helper::arrayElement(first, last) : helper::zipfArrayElement(first, last, skew); };
+
     if (!length)
     {
-        return helper::arrayElement(start, end);
+        return element(start, end);
     }
 
     size_t length_64 = *length;
@@ -25,12 +33,12 @@ auto sortedSizeArrayElement(std::optional<unsigned int> length, It start, It end
 
     if (lower_it == end)
     {
-        return helper::arrayElement(start, end);
+        return element(start, end);
     }
 
     if (lower_it->size() != length)
     {
-        return helper::arrayElement(start, end);
+        return element(start, end);
     }
 
     auto upper_it = lower_it;
@@ -44,7 +52,7 @@ auto sortedSizeArrayElement(std::optional<unsigned int> length, It start, It end
         }
     }
 
-    return helper::arrayElement(lower_it, upper_it);
+    return element(lower_it, upper_it);
 }
 
 std::string_view sample(std::optional<unsigned int> length)
@@ -52,6 +60,57 @@ std::string_view sample(std::optional<unsigned int> length)
     return sortedSizeArrayElement(length, _allWords.cbegin(), _allWords.cend());
 }
 
+namespace
+{
+// Every dictionary word, the common words first in their rank order and the others after them.
+const std::vector<std::string_view>& popularWords()
+{
+    static const auto words = []
+    {
+        std::vector<std::string_view> ranked(commonWords.begin(), commonWords.end());
+        ranked.reserve(commonWords.size() + _allWords.size());
+
+        std::ranges::copy_if(_allWords, std::back_inserter(ranked), [](std::string_view word)
+                             { return std::ranges::find(commonWords, word) == commonWords.end(); });
+
+        return ranked;
+    }();
+
+    return words;
+}
+
+// popularWords sorted by length, the words of each length keeping their rank order.
+const std::vector<std::string_view>& popularWordsBySize()
+{
+    static const auto words = []
+    {
+        auto sorted = popularWords();
+        std::ranges::stable_sort(sorted, {}, [](std::string_view word) { return word.size(); });
+        return sorted;
+    }();
+
+    return words;
+}
+}
+
+std::string_view sample(std::optional<unsigned int> length, double skew)
+{
+    if (skew < 0.)
+    {
+        throw std::invalid_argument{"Skew must not be negative."};
+    }
+
+    const auto& wordsBySize = popularWordsBySize();
+
+    if (length && std::ranges::binary_search(wordsBySize, std::size_t{*length}, {},
+                                             [](std::string_view word) { return word.size(); }))
+    {
+        return sortedSizeArrayElement(length, wordsBySize.cbegin(), wordsBySize.cend(), skew);
+    }
+
+    return helper::zipfArrayElement(popularWords().cbegin(), popularWords().cend(), skew);
+}
+
 std::string words(unsigned numberOfWords)
 {
     if (numberOfWords == 0)
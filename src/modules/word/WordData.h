@@ -131,6 +131,15 @@ const std::array<std::string_view, adjectives.size() + adverbs.size() + conjunct
     return table;
 }();
 
+// The most frequent English words of the dictionary, most frequent first. Skewed samples rank words by this list.
+const auto commonWords = std::to_array<std::string_view>({
+    "the", "be", "to", "of", "and", "a", "in", "that", "have", "for", "not", "on", "with", "as", "do", "at", "this",
+    "but", "by", "from", "say", "or", "an", "will", "all", "what", "so", "up", "out", "if", "about", "who", "get",
+    "which", "go", "when", "make", "can", "like", "time", "know", "take", "people", "into", "year", "good", "some",
+    "see", "other", "than", "now", "look", "only", "come", "over", "think", "back", "after", "use", "how", "our",
+    "work", "first", "well", "way", "even", "new", "want", "because", "any", "these", "give", "day", "most",
+});
+
 const auto _adjectives_sorted = []()
 {
     auto sorted = adjectives;
@@ -4,6 +4,7 @@
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -43,6 +44,42 @@ TEST_F(FormatHelperTest, givenTokensWithNotDefinedGenerator_shouldThrow)
     ASSERT_THROW(fillTokenValues(format, dataGeneratorsMapping), std::runtime_error);
 }
 
+TEST_F(FormatHelperTest, tokenTemplateRendersSlots)
+{
+    const std::vector<TokenSlot<std::string>> slots{
+        {"name", [](const std::string& context, std::string& out) { out += context; }},
+        {"greeting", [](const std::string&, std::string& out) { out += "hello"; }}};
+
+    const TokenTemplate<std::string> tokenTemplate{"{greeting} {name}, {greeting}!", slots};
+
+    std::string out{">"};
+
+    tokenTemplate.render("faker", out);
+
+    EXPECT_EQ(out, ">hello faker, hello!");
+    EXPECT_EQ(tokenTemplate.render("cxx"), "hello cxx, hello!");
+}
+
+TEST_F(FormatHelperTest, givenTokenTemplateWithNotDefinedSlot_shouldThrow)
+{
+    const std::vector<TokenSlot<std::string>> slots{
+        {"name", [](const std::string& context, std::string& out) { out += context; }}};
+
+    ASSERT_THROW((TokenTemplate<std::string>{"{name} {surname}", slots}), std::runtime_error);
+}
+
+TEST_F(FormatHelperTest, tokenTemplateCacheParsesEachFormat)
+{
+    TokenTemplateCache<int> cache{
+        {"number", [](const int& context, std::string& out) { out += std::to_string(context); }}};
+
+    const auto& first = cache["#{number}"];
+
+    EXPECT_EQ(&first, &cache["#{number}"]);
+    EXPECT_NE(&first, &cache["{number}!"]);
+    EXPECT_EQ(cache["{number}!"].render(7), "7!");
+}
+
 TEST_F(FormatHelperTest, shouldFormat)
 {
     EXPECT_EQ(format("{}", 1), "1");
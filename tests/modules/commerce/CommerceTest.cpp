@@ -1,6 +1,7 @@
 #include "faker-cxx/Commerce.h"
 
 #include <algorithm>
+#include <stdexcept>
 #include <string_view>
 
 #include "gtest/gtest.h"
@@ -98,6 +99,19 @@ TEST_F(CommerceTest, shouldGenerateProductName)
                                     { return productName == generatedProductName; }));
 }
 
+TEST_F(CommerceTest, shouldGenerateProductNameWithSkew)
+{
+    const auto generatedProductName = productName(1.1);
+
+    ASSERT_TRUE(std::ranges::any_of(productNames, [generatedProductName](const std::string_view& productName)
+                                    { return productName == generatedProductName; }));
+}
+
+TEST_F(CommerceTest, shouldThrowOnNegativeProductNameSkew)
+{
+    ASSERT_THROW(productName(-1.), std::invalid_argument);
+}
+
 TEST_F(CommerceTest, shouldGenerateEan13)
 {
     const auto generatedEan13 = EAN13();
@@ -1,6 +1,10 @@
 #include "faker-cxx/Datatype.h"
 
 #include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -11,6 +15,13 @@ using namespace faker::datatype;
 class DatatypeTest : public Test
 {
 public:
+    static double setBitRatio(const std::vector<std::uint64_t>& mask)
+    {
+        const auto setBits = std::accumulate(mask.begin(), mask.end(), 0., [](double sum, std::uint64_t word)
+                                             { return sum + std::popcount(word); });
+
+        return setBits / static_cast<double>(mask.size() * 64);
+    }
 };
 
 TEST_F(DatatypeTest, shouldGenerateBoolean)
@@ -37,3 +48,49 @@ TEST_F(DatatypeTest, BooleanWithProbTest)
     const auto result5 = boolean(1.0);
     EXPECT_TRUE(result5);
 }
+
+TEST_F(DatatypeTest, givenNanProbability_shouldGenerateBothValues)
+{
+    bool generatedTrue = false;
+    bool generatedFalse = false;
+
+    for (int i = 0; i < 100; i++)
+    {
+        const auto generatedBoolean = boolean(std::nan(""));
+
+        generatedTrue = generatedTrue || generatedBoolean;
+        generatedFalse = generatedFalse || !generatedBoolean;
+    }
+
+    ASSERT_TRUE(generatedTrue);
+    ASSERT_TRUE(generatedFalse);
+}
+
+TEST_F(DatatypeTest, booleans_shouldSetBitsWithGivenProbability)
+{
+    for (const auto probability : {0.5, 0.25, 0.1, 0.9, 0.001})
+    {
+        std::vector<std::uint64_t> mask(10000);
+
+        booleans(mask, probability);
+
+        ASSERT_NEAR(setBitRatio(mask), probability, 0.005);
+    }
+}
+
+TEST_F(DatatypeTest, booleans_givenProbabilityOutsideUnitInterval_shouldClearOrSetAllBits)
+{
+    std::vector<std::uint64_t> mask(100, 1);
+
+    booleans(mask, 0.);
+
+    ASSERT_TRUE(std::ranges::all_of(mask, [](std::uint64_t word) { return word == 0; }));
+
+    booleans(mask, 1.5);
+
+    ASSERT_TRUE(std::ranges::all_of(mask, [](std::uint64_t word) { return word == ~std::uint64_t{0}; }));
+
+    booleans(mask, std::nan(""));
+
+    ASSERT_NEAR(setBitRatio(mask), 0.5, 0.05);
+}
@@ -1,8 +1,11 @@
 #include "faker-cxx/Finance.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <ranges>
 #include <regex>
+#include <set>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -259,6 +262,27 @@ TEST_F(FinanceTest, shouldGenerateAccountNumberWithSpecifiedLength)
     ASSERT_TRUE(checkIfAllCharactersAreNumeric(generatedAccountNumber));
 }
 
+TEST_F(FinanceTest, shouldGenerateDistinctAccountNumbersFromIndices)
+{
+    std::set<std::string> generatedAccountNumbers;
+
+    for (std::uint64_t index = 0; index < 1000; index++)
+    {
+        const auto generatedAccountNumber = accountNumber(3, index, 42);
+
+        ASSERT_EQ(generatedAccountNumber.size(), 3);
+        ASSERT_TRUE(checkIfAllCharactersAreNumeric(generatedAccountNumber));
+        ASSERT_EQ(generatedAccountNumber, accountNumber(3, index, 42));
+
+        generatedAccountNumbers.insert(generatedAccountNumber);
+    }
+
+    ASSERT_EQ(generatedAccountNumbers.size(), 1000);
+    ASSERT_EQ(accountNumber(19, 9'999'999'999'999'999'999u, 42).size(), 19);
+    ASSERT_THROW(accountNumber(3, 1000, 42), std::invalid_argument);
+    ASSERT_THROW(accountNumber(20, 0, 42), std::invalid_argument);
+}
+
 TEST_F(FinanceTest, shouldGeneratePinNumber)
 {
     const auto generatedPin = pin();
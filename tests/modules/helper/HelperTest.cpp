@@ -2,15 +2,29 @@
 #include <common/AlgoHelper.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cctype>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <ranges>
 #include <regex>
 #include <set>
 #include <span>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "faker-cxx/Sampling.h"
+#include "faker-cxx/StringParts.h"
+#include "faker-cxx/Unique.h"
+#include "faker-cxx/ValuePool.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -54,6 +68,110 @@ TEST_F(HelperTest, ArrayElementSpanEmptyData)
     ASSERT_THROW(arrayElement(std::span<const std::string>(data)), std::invalid_argument);
 }
 
+TEST_F(HelperTest, ZipfArrayElement)
+{
+    std::vector<std::string> data{"hello", "world", "this", "is", "faker-cxx", "library"};
+
+    std::unordered_map<std::string, int> counts;
+
+    for (int i = 0; i < 6000; i++)
+    {
+        counts[zipfArrayElement(data.begin(), data.end(), 1.5)]++;
+    }
+
+    ASSERT_TRUE(std::ranges::all_of(counts, [&data](const auto& count)
+                                    { return std::ranges::find(data, count.first) != data.end(); }));
+    ASSERT_GT(counts["hello"], counts["world"]);
+    ASSERT_GT(counts["world"], counts["library"]);
+}
+
+TEST_F(HelperTest, ZipfArrayElementSpan)
+{
+    std::vector<std::string> data{"hello", "world"};
+
+    const auto result = zipfArrayElement(std::span<const std::string>(data), 1.);
+
+    ASSERT_TRUE(std::ranges::any_of(data, [&result](const std::string& element) { return result == element; }));
+}
+
+TEST_F(HelperTest, ZipfArrayElementEmptyData)
+{
+    std::vector<std::string> data{};
+
+    ASSERT_THROW(zipfArrayElement(std::span<const std::string>(data), 1.), std::invalid_argument);
+}
+
+TEST_F(HelperTest, ArrayElements)
+{
+    const std::array<std::string, 6> data{"hello", "world", "this", "is", "faker-cxx", "library"};
+
+    const auto result = arrayElements(data, 4);
+
+    std::set<const std::string*> addresses;
+
+    for (const auto& element : result)
+    {
+        ASSERT_TRUE(&element.get() >= data.data() && &element.get() < data.data() + data.size());
+
+        addresses.insert(&element.get());
+    }
+
+    ASSERT_EQ(addresses.size(), 4u);
+}
+
+TEST_F(HelperTest, ArrayElementsAll)
+{
+    const std::vector<int> data{1, 2, 3, 4, 5, 6, 7, 8};
+
+    const auto result = arrayElements(std::span<const int>{data}, data.size());
+
+    std::vector<int> values(result.begin(), result.end());
+
+    std::ranges::sort(values);
+
+    ASSERT_EQ(values, data);
+    ASSERT_TRUE(arrayElements(std::span<const int>{data}, 0).empty());
+}
+
+TEST_F(HelperTest, ArrayElementsCountGreaterThanSize)
+{
+    const std::array<int, 3> data{1, 2, 3};
+
+    ASSERT_THROW(arrayElements(data, 4), std::invalid_argument);
+}
+
+TEST_F(HelperTest, DistinctIndices)
+{
+    for (const std::size_t size : {std::size_t{1000}, std::size_t{1000000}})
+    {
+        for (const std::size_t count : {std::size_t{3}, std::size_t{100}, std::size_t{900}})
+        {
+            const auto indices = distinctIndices(size, count);
+
+            const std::set<std::size_t> uniqueIndices(indices.begin(), indices.end());
+
+            ASSERT_EQ(indices.size(), count);
+            ASSERT_EQ(uniqueIndices.size(), count);
+            ASSERT_LT(*uniqueIndices.rbegin(), size);
+        }
+    }
+}
+
+TEST_F(HelperTest, DistinctIndicesUniformPositions)
+{
+    std::array<unsigned, 5> firstCounts{};
+
+    for (int i = 0; i < 25000; i++)
+    {
+        firstCounts[distinctIndices(5, 2)[0]]++;
+    }
+
+    for (const auto firstCount : firstCounts)
+    {
+        ASSERT_NEAR(firstCount / 25000.0, 0.2, 0.02);
+    }
+}
+
 TEST_F(HelperTest, WeightedArrayElement)
 {
     std::vector<WeightedElement<std::string>> data{{1, "hello"}, {9, "world"}};
@@ -78,6 +196,585 @@ TEST_F(HelperTest, WeightedArrayEmptyData)
     ASSERT_THROW(weightedArrayElement(data), std::invalid_argument);
 }
 
+TEST_F(HelperTest, WeightedSampler)
+{
+    const WeightedSampler sampler{std::vector<WeightedElement<std::string>>{{1, "hello"}, {0, "never"}, {3, "world"}}};
+
+    std::unordered_map<std::string, unsigned> counts;
+
+    for (int i = 0; i < 40000; i++)
+    {
+        counts[sampler()]++;
+    }
+
+    ASSERT_EQ(sampler.size(), 3u);
+    ASSERT_EQ(counts.count("never"), 0u);
+    ASSERT_NEAR(counts["hello"] / 40000.0, 0.25, 0.015);
+    ASSERT_NEAR(counts["world"] / 40000.0, 0.75, 0.015);
+}
+
+TEST_F(HelperTest, WeightedSamplerConstexpr)
+{
+    static constexpr WeightedSampler sampler{
+        std::array<WeightedElement<std::string_view>, 3>{{{2, "red"}, {1, "green"}, {1, "blue"}}}};
+
+    std::unordered_map<std::string_view, unsigned> counts;
+
+    for (int i = 0; i < 40000; i++)
+    {
+        counts[sampler()]++;
+    }
+
+    ASSERT_NEAR(counts["red"] / 40000.0, 0.5, 0.015);
+    ASSERT_NEAR(counts["green"] / 40000.0, 0.25, 0.015);
+    ASSERT_NEAR(counts["blue"] / 40000.0, 0.25, 0.015);
+}
+
+TEST_F(HelperTest, WeightedSamplerBulk)
+{
+    const WeightedSampler sampler{std::vector<WeightedElement<int>>{{1, 1}, {1, 2}, {2, 3}}};
+
+    std::vector<int> values(4000);
+
+    sampler(std::span<int>{values});
+
+    ASSERT_TRUE(std::ranges::all_of(values, [](int value) { return value >= 1 && value <= 3; }));
+    ASSERT_NEAR(static_cast<double>(std::ranges::count(values, 3)) / 4000.0, 0.5, 0.04);
+}
+
+TEST_F(HelperTest, WeightedSamplerInvalidData)
+{
+    ASSERT_THROW(WeightedSampler{std::vector<WeightedElement<int>>{}}, std::invalid_argument);
+    ASSERT_THROW((WeightedSampler{std::vector<WeightedElement<int>>{{0, 1}, {0, 2}}}), std::invalid_argument);
+}
+
+TEST_F(HelperTest, Unique)
+{
+    auto digits = unique([] { return number::integer(0, 99); });
+
+    std::set<int> values;
+
+    for (int i = 0; i < 100; i++)
+    {
+        values.insert(digits());
+    }
+
+    const auto stats = digits.stats();
+
+    ASSERT_EQ(values.size(), 100u);
+    ASSERT_THROW(digits(), std::runtime_error);
+    ASSERT_EQ(stats.generated, 100u);
+    ASSERT_GT(stats.rejected, 0u);
+    ASSERT_GT(stats.retryRate(), 0.);
+    ASSERT_FALSE(stats.approximate);
+    ASSERT_GT(stats.memoryBytes, 0u);
+}
+
+TEST_F(HelperTest, UniqueApproximateOverflow)
+{
+    UniqueOptions options;
+    options.exactLimit = 1000;
+    options.expectedCount = 10000;
+
+    auto words = unique([] { return std::to_string(random::engine()() % 100000); }, options);
+
+    std::set<std::string> values;
+
+    for (int i = 0; i < 5000; i++)
+    {
+        ASSERT_TRUE(values.insert(words()).second);
+    }
+
+    const auto stats = words.stats();
+
+    ASSERT_TRUE(stats.approximate);
+    ASSERT_EQ(stats.generated, 5000u);
+    ASSERT_EQ(stats.memoryBytes, BloomFilter(10000, 0.001).memoryBytes());
+}
+
+TEST_F(HelperTest, ShardedUnique)
+{
+    ShardedUnique numbers{[] { return number::integer<std::uint64_t>(0, 999999); }, UniqueOptions{}, 8};
+
+    std::vector<std::vector<std::uint64_t>> threadValues(4);
+    std::vector<std::thread> threads;
+
+    for (auto& values : threadValues)
+    {
+        threads.emplace_back(
+            [&numbers, &values]
+            {
+                for (int i = 0; i < 2000; i++)
+                {
+                    values.push_back(numbers());
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::set<std::uint64_t> allValues;
+
+    for (const auto& values : threadValues)
+    {
+        allValues.insert(values.begin(), values.end());
+    }
+
+    ASSERT_EQ(allValues.size(), 8000u);
+    ASSERT_EQ(numbers.stats().generated, 8000u);
+}
+
+TEST_F(HelperTest, ShardedUniqueShouldCallGeneratorThroughConstReference)
+{
+    struct ConstOnlyGenerator
+    {
+        std::uint64_t operator()() const
+        {
+            return number::integer<std::uint64_t>(0, 999999);
+        }
+
+        std::uint64_t operator()() = delete;
+    };
+
+    ShardedUnique numbers{ConstOnlyGenerator{}};
+
+    ASSERT_NE(numbers(), numbers());
+}
+
+TEST_F(HelperTest, ValuePool)
+{
+    ValuePool pool{1000, [] { return std::to_string(number::integer<std::uint64_t>(0, 999999999)); }};
+
+    ASSERT_EQ(pool.size(), 1000u);
+
+    std::set<std::string_view> values;
+    std::size_t textSize = 0;
+
+    for (std::size_t i = 0; i < pool.size(); i++)
+    {
+        values.insert(pool[i]);
+        textSize += pool[i].size();
+    }
+
+    ASSERT_GT(values.size(), 990u);
+    ASSERT_EQ(pool.arenaBytes(), textSize);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        ASSERT_TRUE(values.contains(pool()));
+    }
+}
+
+TEST_F(HelperTest, ValuePoolIsIndependentOfThreadCount)
+{
+    const auto generator = [] { return std::to_string(number::integer<std::uint64_t>(0, 999999999)); };
+
+    const random::RecordScope singleThreadScope{7, 0};
+
+    const ValuePool singleThreadPool{5000, generator, {.threadCount = 1}};
+
+    const random::RecordScope multiThreadScope{7, 0};
+
+    const ValuePool multiThreadPool{5000, generator, {.threadCount = 4}};
+
+    for (std::size_t i = 0; i < singleThreadPool.size(); i++)
+    {
+        ASSERT_EQ(singleThreadPool[i], multiThreadPool[i]);
+    }
+}
+
+TEST_F(HelperTest, ValuePoolWithZipfDistribution)
+{
+    ValuePool pool{1000, [] { return std::string{"value"}; }, {.distribution = PoolDistribution::Zipf}};
+
+    int firstValueDraws = 0;
+    int lastValueDraws = 0;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        const auto value = pool();
+
+        firstValueDraws += value.data() == pool[0].data() ? 1 : 0;
+        lastValueDraws += value.data() == pool[999].data() ? 1 : 0;
+    }
+
+    ASSERT_GT(firstValueDraws, 1000);
+    ASSERT_LT(lastValueDraws, 10);
+}
+
+TEST_F(HelperTest, ValuePoolRefreshesAfterDraws)
+{
+    std::atomic<int> calls{0};
+
+    ValuePool pool{100, [&calls] { return std::to_string(calls++); }, {.refreshAfterDraws = 50}};
+
+    const ValuePool copy = pool;
+
+    for (int i = 0; i < 50; i++)
+    {
+        pool();
+    }
+
+    ASSERT_EQ(calls, 100);
+
+    pool();
+
+    ASSERT_EQ(calls, 200);
+    ASSERT_NE(pool[0], copy[0]);
+}
+
+TEST_F(HelperTest, ValuePoolInvalidArguments)
+{
+    ASSERT_THROW((ValuePool{0, [] { return std::string{}; }}), std::invalid_argument);
+    ASSERT_THROW(
+        (ValuePool{10, [] { return std::string{}; }, {.distribution = PoolDistribution::Zipf, .zipfExponent = -1}}),
+        std::invalid_argument);
+    ASSERT_THROW((ValuePool{1000, []() -> std::string { throw std::runtime_error{"generator failed"}; }}),
+                 std::runtime_error);
+}
+
+TEST_F(HelperTest, ReservoirSampleIsUniform)
+{
+    std::vector<int> stream(100);
+
+    std::iota(stream.begin(), stream.end(), 0);
+
+    std::vector<int> counts(stream.size());
+
+    for (int trial = 0; trial < 20000; trial++)
+    {
+        const auto sample = reservoirSample(stream, 10);
+
+        ASSERT_EQ(sample.size(), 10u);
+        ASSERT_EQ(std::set<int>(sample.begin(), sample.end()).size(), 10u);
+
+        for (const auto value : sample)
+        {
+            counts[static_cast<std::size_t>(value)]++;
+        }
+    }
+
+    for (const auto count : counts)
+    {
+        ASSERT_NEAR(count, 2000, 250);
+    }
+}
+
+TEST_F(HelperTest, ReservoirSamplerPushedOneByOne)
+{
+    ReservoirSampler<std::string> sampler{3};
+
+    sampler.push("a");
+    sampler.push("b");
+
+    ASSERT_THAT(sampler.sample(), ElementsAre("a", "b"));
+
+    std::vector<int> counts(1000);
+
+    for (int trial = 0; trial < 3000; trial++)
+    {
+        ReservoirSampler<int> numbers{3};
+
+        for (int value = 0; value < 1000; value++)
+        {
+            numbers.push(value);
+        }
+
+        ASSERT_EQ(numbers.count(), 1000u);
+
+        for (const auto value : numbers.sample())
+        {
+            counts[static_cast<std::size_t>(value)]++;
+        }
+    }
+
+    ASSERT_NEAR(std::accumulate(counts.begin(), counts.begin() + 500, 0), 4500, 300);
+}
+
+TEST_F(HelperTest, ReservoirSampleFromInputIterators)
+{
+    std::istringstream words{"alpha beta gamma delta epsilon"};
+
+    const auto sample = reservoirSample(std::views::istream<std::string>(words), 2);
+
+    ASSERT_EQ(sample.size(), 2u);
+    ASSERT_NE(sample[0], sample[1]);
+
+    ASSERT_THAT(reservoirSample(std::vector<int>{1, 2}, 5), ElementsAre(1, 2));
+    ASSERT_THROW(reservoirSample(std::vector<int>{1, 2}, 0), std::invalid_argument);
+}
+
+TEST_F(HelperTest, WeightedReservoirSample)
+{
+    const std::vector<std::pair<int, double>> elements{{0, 1.}, {1, 2.}, {2, 3.}, {3, 4.}, {4, 0.}};
+
+    std::vector<int> counts(elements.size());
+
+    for (int trial = 0; trial < 20000; trial++)
+    {
+        const auto sample = weightedReservoirSample(elements, 1, [](const auto& element) { return element.second; });
+
+        ASSERT_EQ(sample.size(), 1u);
+
+        counts[static_cast<std::size_t>(sample[0].first)]++;
+    }
+
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        ASSERT_NEAR(counts[i], 2000 * (static_cast<int>(i) + 1), 300);
+    }
+
+    ASSERT_EQ(counts[4], 0);
+}
+
+TEST_F(HelperTest, WeightedReservoirSamplerOverLongStream)
+{
+    std::vector<int> counts(2);
+
+    for (int trial = 0; trial < 2000; trial++)
+    {
+        WeightedReservoirSampler<int> sampler{10};
+
+        for (int value = 0; value < 10000; value++)
+        {
+            sampler.push(value, value < 5000 ? 1. : 3.);
+        }
+
+        const auto sample = std::move(sampler).sample();
+
+        ASSERT_EQ(std::set<int>(sample.begin(), sample.end()).size(), 10u);
+
+        for (const auto value : sample)
+        {
+            counts[value < 5000 ? 0 : 1]++;
+        }
+    }
+
+    ASSERT_NEAR(static_cast<double>(counts[1]) / counts[0], 3., 0.3);
+}
+
+TEST_F(HelperTest, WeightedReservoirSamplerInvalidArguments)
+{
+    ASSERT_THROW(WeightedReservoirSampler<int>{0}, std::invalid_argument);
+
+    WeightedReservoirSampler<int> sampler{2};
+
+    ASSERT_THROW(sampler.push(1, -1.), std::invalid_argument);
+    ASSERT_THROW(sampler.push(1, std::numeric_limits<double>::infinity()), std::invalid_argument);
+    ASSERT_THROW(sampler.push(1, std::numeric_limits<double>::quiet_NaN()), std::invalid_argument);
+}
+
+TEST_F(HelperTest, ShuffleSmallRange)
+{
+    std::vector<int> values(1000);
+
+    std::iota(values.begin(), values.end(), 0);
+
+    auto shuffled = values;
+
+    shuffle(shuffled);
+
+    ASSERT_NE(shuffled, values);
+
+    std::ranges::sort(shuffled);
+
+    ASSERT_EQ(shuffled, values);
+}
+
+TEST_F(HelperTest, ShuffleLargeRangeIsIndependentOfThreadCount)
+{
+    std::vector<std::uint32_t> values((1 << 18) + 12345);
+
+    std::iota(values.begin(), values.end(), 0u);
+
+    auto singleThreadShuffled = values;
+    auto multiThreadShuffled = values;
+
+    {
+        const random::RecordScope scope{11, 0};
+
+        shuffle(singleThreadShuffled, {.threadCount = 1});
+    }
+
+    {
+        const random::RecordScope scope{11, 0};
+
+        shuffle(multiThreadShuffled, {.threadCount = 4});
+    }
+
+    ASSERT_EQ(singleThreadShuffled, multiThreadShuffled);
+
+    const auto half = static_cast<std::uint32_t>(values.size() / 2);
+    const auto stayedInFirstHalf = std::count_if(singleThreadShuffled.begin(), singleThreadShuffled.begin() + half,
+                                                 [half](std::uint32_t value) { return value < half; });
+
+    ASSERT_NEAR(static_cast<double>(stayedInFirstHalf) / half, 0.5, 0.02);
+
+    std::ranges::sort(singleThreadShuffled);
+
+    ASSERT_EQ(singleThreadShuffled, values);
+}
+
+TEST_F(HelperTest, ShuffleLargeRangeWithThrowingMove)
+{
+    struct Row
+    {
+        Row() = default;
+
+        explicit Row(std::uint32_t rowId) : id{rowId} {}
+
+        Row(const Row&) = default;
+        Row(Row&& other) noexcept(false) : id{other.id} {}
+
+        Row& operator=(const Row&) = default;
+
+        Row& operator=(Row&& other) noexcept(false)
+        {
+            id = other.id;
+
+            return *this;
+        }
+
+        std::uint32_t id = 0;
+    };
+
+    std::vector<Row> rows;
+
+    for (std::uint32_t rowId = 0; rowId < (1 << 18) + 12345; rowId++)
+    {
+        rows.emplace_back(rowId);
+    }
+
+    shuffle(rows, {.threadCount = 4});
+
+    std::vector<std::uint32_t> ids;
+
+    for (const auto& row : rows)
+    {
+        ids.push_back(row.id);
+    }
+
+    ASSERT_FALSE(std::ranges::is_sorted(ids));
+
+    std::vector<std::uint32_t> expectedIds(rows.size());
+
+    std::iota(expectedIds.begin(), expectedIds.end(), 0u);
+    std::ranges::sort(ids);
+
+    ASSERT_EQ(ids, expectedIds);
+}
+
+TEST_F(HelperTest, ShuffleIsUniform)
+{
+    std::array<int, 4> counts{};
+
+    for (int trial = 0; trial < 8000; trial++)
+    {
+        std::array<int, 4> values{0, 1, 2, 3};
+
+        shuffle(values);
+
+        counts[static_cast<std::size_t>(values[0])]++;
+    }
+
+    for (const auto count : counts)
+    {
+        ASSERT_NEAR(count, 2000, 200);
+    }
+}
+
+TEST_F(HelperTest, BloomFilter)
+{
+    BloomFilter filter{10000, 0.01};
+
+    for (std::uint64_t i = 0; i < 10000; i++)
+    {
+        std::uint64_t state = i;
+
+        filter.insert(random::detail::splitMix64(state));
+    }
+
+    for (std::uint64_t i = 0; i < 10000; i++)
+    {
+        std::uint64_t state = i;
+
+        ASSERT_TRUE(filter.mayContain(random::detail::splitMix64(state)));
+    }
+
+    unsigned falsePositives = 0;
+
+    for (std::uint64_t i = 0; i < 100000; i++)
+    {
+        std::uint64_t state = i + (1ull << 40);
+
+        falsePositives += filter.mayContain(random::detail::splitMix64(state)) ? 1u : 0u;
+    }
+
+    ASSERT_LT(falsePositives, 2000u);
+    ASSERT_THROW(BloomFilter(0, 0.01), std::invalid_argument);
+    ASSERT_THROW(BloomFilter(10, 1.), std::invalid_argument);
+}
+
+TEST_F(HelperTest, Concat)
+{
+    const auto part = concat("a", std::string{"b"}, [](std::string& out) { out += 'c'; });
+
+    std::string out{">"};
+
+    part(out);
+
+    ASSERT_EQ(out, ">abc");
+    ASSERT_EQ(render(concat()), "");
+}
+
+TEST_F(HelperTest, MaybePart)
+{
+    ASSERT_EQ(render(maybe("x", 1.)), "x");
+    ASSERT_EQ(render(maybe("x", 0.)), "");
+}
+
+TEST_F(HelperTest, OneOf)
+{
+    const auto part = oneOf("a", "b", concat("c", "d"));
+
+    std::unordered_map<std::string, unsigned> counts;
+
+    for (int i = 0; i < 30000; i++)
+    {
+        counts[render(part)]++;
+    }
+
+    ASSERT_EQ(counts.size(), 3u);
+    ASSERT_NEAR(counts["cd"] / 30000.0, 1.0 / 3, 0.02);
+}
+
+TEST_F(HelperTest, WeightedOneOf)
+{
+    const auto part = weightedOneOf(WeightedElement<const char*>{3, "a"}, WeightedElement<const char*>{0, "b"},
+                                    WeightedElement<const char*>{1, "c"});
+
+    std::unordered_map<std::string, unsigned> counts;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        counts[render(part)]++;
+    }
+
+    ASSERT_EQ(counts.count("b"), 0u);
+    ASSERT_NEAR(counts["a"] / 20000.0, 0.75, 0.02);
+    ASSERT_THROW(weightedOneOf(WeightedElement<const char*>{0, "a"}), std::invalid_argument);
+}
+
+TEST_F(HelperTest, Repeat)
+{
+    ASSERT_EQ(render(repeat(3, "ab", ", ")), "ab, ab, ab");
+    ASSERT_EQ(render(repeat(0, "ab")), "");
+    ASSERT_EQ(render(repeat(2, repeat(2, "x"), "-")), "xx-xx");
+}
+
 TEST_F(HelperTest, ShuffleString)
 {
     std::string input = "Hello World!";
@@ -123,6 +820,64 @@ TEST_F(HelperTest, ReplaceSymbolWithNumber)
     ASSERT_TRUE(std::ranges::all_of(result, ::isdigit));
 }
 
+TEST_F(HelperTest, ReplaceSymbolWithNumberDigitFrequencies)
+{
+    std::array<unsigned, 10> counts{};
+
+    for (int i = 0; i < 2000; i++)
+    {
+        for (const auto digit : replaceSymbolWithNumber("##########-#########"))
+        {
+            if (digit != '-')
+            {
+                counts[static_cast<std::size_t>(digit - '0')]++;
+            }
+        }
+    }
+
+    for (const auto count : counts)
+    {
+        ASSERT_NEAR(count / 38000.0, 0.1, 0.006);
+    }
+}
+
+TEST_F(HelperTest, DigitTemplate)
+{
+    const DigitTemplate phone{"+1 !##-###-####"};
+
+    const auto result = phone();
+
+    ASSERT_EQ(result.size(), phone.size());
+    ASSERT_TRUE(result.starts_with("+1 "));
+    ASSERT_GE(result[3], '2');
+    ASSERT_EQ(result[6], '-');
+    ASSERT_TRUE(std::all_of(result.begin() + 3, result.end(), [](char c) { return c == '-' || std::isdigit(c); }));
+}
+
+TEST_F(HelperTest, DigitTemplateBulk)
+{
+    const DigitTemplate code{"AB-*-*", '*'};
+
+    std::string out(code.size() * 2000, ' ');
+
+    code.render(out);
+
+    std::set<std::string> codes;
+
+    for (std::size_t i = 0; i < 2000; i++)
+    {
+        const auto rendered = out.substr(i * code.size(), code.size());
+
+        ASSERT_TRUE(rendered.starts_with("AB-"));
+        ASSERT_TRUE(std::isdigit(rendered[3]) && std::isdigit(rendered[5]));
+
+        codes.insert(rendered);
+    }
+
+    ASSERT_EQ(codes.size(), 100u);
+    ASSERT_THROW(code.render(std::span<char>{out.data(), 7}), std::invalid_argument);
+}
+
 TEST_F(HelperTest, RegexpStyleStringParse)
 {
     std::string input = "#{5}[2-4]test[1-3]";
@@ -141,6 +896,40 @@ TEST_F(HelperTest, RegexpStyleStringParseMaxMin)
     ASSERT_THAT(result.size(), AllOf(Ge(11),Le(12)));
 }
 
+TEST_F(HelperTest, RegexpStyleStringParseCharacterClass)
+{
+    const auto result = regexpStyleStringParse("ID-[0-9A-F]{8}-[xyz]");
+
+    ASSERT_EQ(result.size(), 13);
+    ASSERT_TRUE(result.starts_with("ID-"));
+    ASSERT_TRUE(std::all_of(result.begin() + 3, result.begin() + 11, [](char character)
+                            { return std::isdigit(character) || (character >= 'A' && character <= 'F'); }));
+    ASSERT_EQ(result[11], '-');
+    ASSERT_NE(std::string{"xyz"}.find(result.back()), std::string::npos);
+}
+
+TEST_F(HelperTest, RegexpStyleStringParseNumberRange)
+{
+    for (int i = 0; i < 100; i++)
+    {
+        const auto result = regexpStyleStringParse("[10-20]{2,3}");
+
+        ASSERT_THAT(result.size(), AllOf(Ge(4), Le(6)));
+        ASSERT_TRUE(std::ranges::all_of(result, ::isdigit));
+
+        const auto first = std::stoi(result.substr(0, 2));
+
+        ASSERT_THAT(first, AllOf(Ge(10), Le(20)));
+    }
+}
+
+TEST_F(HelperTest, RegexpStyleStringParseLiterals)
+{
+    ASSERT_EQ(regexpStyleStringParse("ab{3}c"), "abbbc");
+    ASSERT_EQ(regexpStyleStringParse("{3}a{x}[]"), "{3}a{x}[]");
+    ASSERT_EQ(regexpStyleStringParse("a{0}b{1,1}"), "b");
+}
+
 TEST_F(HelperTest, ReplaceCreditCardSymbols)
 {
     const auto result_default = replaceCreditCardSymbols();
@@ -175,36 +964,3 @@ TEST_F(HelperTest, ObjectKeyTest)
 
     ASSERT_THROW({ objectKey(emptyMap); }, std::runtime_error);
 }
-
-TEST_F(HelperTest, MaybeString)
-{
-    double highProbability = 1;
-    auto result = maybe<std::string>([]() { return "Hello World!"; }, highProbability);
-    EXPECT_EQ(result, "Hello World!");
-
-    double lowProbability = 0;
-    result = maybe<std::string>([]() { return "Hello World!"; }, lowProbability);
-    EXPECT_EQ(result, "");
-}
-
-TEST_F(HelperTest, MaybeInt)
-{
-    double highProbability = 1;
-    auto result = maybe<int>([]() { return 42; }, highProbability);
-    EXPECT_EQ(result, 42);
-
-    double lowProbability = 0;
-    result = maybe<int>([]() { return 42; }, lowProbability);
-    EXPECT_EQ(result, 0);
-}
-
-TEST_F(HelperTest, MaybeDouble)
-{
-    double highProbability = 1;
-    auto result = maybe<double>([]() { return 3.14; }, highProbability);
-    EXPECT_EQ(result, 3.14);
-
-    double lowProbability = 0;
-    result = maybe<double>([]() { return 3.14; }, lowProbability);
-    EXPECT_EQ(result, 0.0);
-}
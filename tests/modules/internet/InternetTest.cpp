@@ -5,6 +5,7 @@
 #include <cctype>
 #include <initializer_list>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -685,6 +686,27 @@ TEST_F(InternetTest, shouldGenerateDomainSuffix)
                                     { return generatedDomainSuffix == domainSuffix; }));
 }
 
+TEST_F(InternetTest, shouldGenerateDomainSuffixWithSkew)
+{
+    const auto generatedDomainSuffix = domainSuffix(1.2);
+
+    ASSERT_TRUE(std::ranges::any_of(domainSuffixes, [generatedDomainSuffix](const std::string_view& domainSuffix)
+                                    { return generatedDomainSuffix == domainSuffix; }));
+}
+
+TEST_F(InternetTest, shouldGenerateMostPopularDomainSuffixMostOftenWithSkew)
+{
+    int comCount = 0;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        comCount += domainSuffix(1.2) == "com" ? 1 : 0;
+    }
+
+    ASSERT_GT(comCount, 350);
+    ASSERT_THROW(domainSuffix(-1.), std::invalid_argument);
+}
+
 TEST_F(InternetTest, shouldGenerateDomainWord)
 {
     const auto generatedDomainWord = domainWord();
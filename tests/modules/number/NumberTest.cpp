@@ -1,6 +1,14 @@
 #include "faker-cxx/Number.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -11,6 +19,15 @@ using namespace faker::number;
 class NumberTest : public Test
 {
 public:
+    static std::pair<double, double> meanAndVariance(const std::vector<double>& values)
+    {
+        const auto count = static_cast<double>(values.size());
+        const auto mean = std::accumulate(values.begin(), values.end(), 0.) / count;
+        const auto squares = std::accumulate(values.begin(), values.end(), 0., [mean](double sum, double value)
+                                             { return sum + (value - mean) * (value - mean); });
+
+        return {mean, squares / count};
+    }
 };
 
 TEST_F(NumberTest, integer_givenInvalidRangeArguments_shouldThrowInvalidArgument)
@@ -60,3 +77,370 @@ TEST_F(NumberTest, givenRangeWithSameNumberSection_shouldGenerateThisNumberForDe
 
     ASSERT_EQ(actualRandomNumber, 2.f);
 }
+
+TEST_F(NumberTest, integers_givenInvalidRangeArguments_shouldThrowInvalidArgument)
+{
+    std::vector<int> values(10);
+
+    ASSERT_THROW(integers<int>(values, 10, 2), std::invalid_argument);
+}
+
+TEST_F(NumberTest, integers_givenValidRange_shouldFillSpanWithNumbersWithinGivenRange)
+{
+    std::vector<int> values(1000);
+
+    integers<int>(values, -5, 10);
+
+    ASSERT_TRUE(std::ranges::all_of(values, [](int value) { return value >= -5 && value <= 10; }));
+    ASSERT_TRUE(std::ranges::any_of(values, [](int value) { return value == -5; }));
+    ASSERT_TRUE(std::ranges::any_of(values, [](int value) { return value == 10; }));
+}
+
+TEST_F(NumberTest, integers_givenFullRangeOfType_shouldFillSpan)
+{
+    std::vector<std::uint8_t> bytes(1000);
+    std::vector<std::int64_t> words(100);
+
+    integers<std::uint8_t>(bytes, 0, 255);
+    integers<std::int64_t>(words, (std::numeric_limits<std::int64_t>::min)(),
+                           (std::numeric_limits<std::int64_t>::max)());
+
+    ASSERT_TRUE(std::ranges::any_of(bytes, [](std::uint8_t value) { return value > 127; }));
+    ASSERT_TRUE(std::ranges::any_of(words, [](std::int64_t value) { return value < 0; }));
+    ASSERT_TRUE(std::ranges::any_of(words, [](std::int64_t value) { return value > 0; }));
+}
+
+TEST_F(NumberTest, integers_givenOutputIterator_shouldWriteCountNumbersWithinGivenRange)
+{
+    std::vector<long> values;
+
+    integers(std::back_inserter(values), 100, 3L, 7L);
+
+    ASSERT_EQ(values.size(), 100);
+    ASSERT_TRUE(std::ranges::all_of(values, [](long value) { return value >= 3 && value <= 7; }));
+}
+
+TEST_F(NumberTest, givenFullRangeOfType_shouldGenerateNumber)
+{
+    const auto actualRandomNumber = integer<std::int8_t>(-128, 127);
+
+    ASSERT_TRUE(actualRandomNumber >= -128);
+    ASSERT_TRUE(actualRandomNumber <= 127);
+}
+
+TEST_F(NumberTest, givenRangeWiderThanLargestValue_shouldGenerateFiniteDecimalWithinGivenRange)
+{
+    const auto lowest = std::numeric_limits<double>::lowest();
+    const auto max = (std::numeric_limits<double>::max)();
+
+    for (int i = 0; i < 100; i++)
+    {
+        const auto actualRandomNumber = decimal<double>(lowest, max);
+
+        ASSERT_TRUE(std::isfinite(actualRandomNumber));
+        ASSERT_TRUE(actualRandomNumber >= lowest);
+        ASSERT_TRUE(actualRandomNumber <= max);
+    }
+}
+
+TEST_F(NumberTest, givenLongDouble_shouldGenerateDecimalNumberThatIsInGivenRange)
+{
+    const auto actualRandomNumber = decimal<long double>(-1.5L, 2.5L);
+
+    ASSERT_TRUE(actualRandomNumber >= -1.5L);
+    ASSERT_TRUE(actualRandomNumber <= 2.5L);
+}
+
+TEST_F(NumberTest, decimals_givenInvalidRangeArguments_shouldThrowInvalidArgument)
+{
+    std::vector<double> values(10);
+
+    ASSERT_THROW(decimals<double>(values, 10., 2.), std::invalid_argument);
+}
+
+TEST_F(NumberTest, decimals_givenValidRange_shouldFillSpanWithNumbersWithinGivenRange)
+{
+    std::vector<double> doubles(1000);
+    std::vector<float> floats(1000);
+
+    decimals<double>(doubles, -2.5, 7.5);
+    decimals<float>(floats, 0.f, 1.f);
+
+    ASSERT_TRUE(std::ranges::all_of(doubles, [](double value) { return value >= -2.5 && value <= 7.5; }));
+    ASSERT_TRUE(std::ranges::any_of(doubles, [](double value) { return value < 0.; }));
+    ASSERT_TRUE(std::ranges::any_of(doubles, [](double value) { return value > 5.; }));
+    ASSERT_TRUE(std::ranges::all_of(floats, [](float value) { return value >= 0.f && value <= 1.f; }));
+}
+
+TEST_F(NumberTest, normal_givenNegativeStandardDeviation_shouldThrowInvalidArgument)
+{
+    std::vector<double> values(10);
+
+    ASSERT_THROW(normal(0., -1.), std::invalid_argument);
+    ASSERT_THROW(normals(values, 0., -1.), std::invalid_argument);
+    ASSERT_THROW(lognormal(0., -1.), std::invalid_argument);
+}
+
+TEST_F(NumberTest, normals_shouldMatchMeanAndStandardDeviation)
+{
+    std::vector<double> values(200000);
+
+    normals(values, 10., 2.);
+
+    const auto [mean, variance] = meanAndVariance(values);
+
+    ASSERT_NEAR(mean, 10., 0.05);
+    ASSERT_NEAR(variance, 4., 0.1);
+    ASSERT_TRUE(std::ranges::any_of(values, [](double value) { return value > 10. + 2. * 3.7; }));
+}
+
+TEST_F(NumberTest, normal_shouldMatchMeanAndStandardDeviation)
+{
+    std::vector<double> values(200000);
+
+    std::ranges::generate(values, [] { return normal(-3., 0.5); });
+
+    const auto [mean, variance] = meanAndVariance(values);
+
+    ASSERT_NEAR(mean, -3., 0.01);
+    ASSERT_NEAR(variance, 0.25, 0.01);
+}
+
+TEST_F(NumberTest, lognormals_shouldGeneratePositiveNumbersWithMatchingLogMean)
+{
+    std::vector<double> values(100000);
+
+    lognormals(values, 1., 0.5);
+
+    ASSERT_TRUE(std::ranges::all_of(values, [](double value) { return value > 0.; }));
+
+    std::ranges::transform(values, values.begin(), [](double value) { return std::log(value); });
+
+    ASSERT_NEAR(meanAndVariance(values).first, 1., 0.01);
+    ASSERT_GT(lognormal(1., 0.5), 0.);
+}
+
+TEST_F(NumberTest, exponential_givenRateNotGreaterThanZero_shouldThrowInvalidArgument)
+{
+    std::vector<double> values(10);
+
+    ASSERT_THROW(exponential(0.), std::invalid_argument);
+    ASSERT_THROW(exponentials(values, -1.), std::invalid_argument);
+}
+
+TEST_F(NumberTest, exponentials_shouldMatchMean)
+{
+    std::vector<double> values(200000);
+
+    exponentials(values, 0.25);
+
+    const auto [mean, variance] = meanAndVariance(values);
+
+    ASSERT_TRUE(std::ranges::all_of(values, [](double value) { return value >= 0.; }));
+    ASSERT_NEAR(mean, 4., 0.05);
+    ASSERT_NEAR(variance, 16., 0.5);
+    ASSERT_GE(exponential(2.), 0.);
+}
+
+TEST_F(NumberTest, poisson_givenNegativeMean_shouldThrowInvalidArgument)
+{
+    std::vector<std::uint64_t> values(10);
+
+    ASSERT_THROW(poisson(-1.), std::invalid_argument);
+    ASSERT_THROW(poissons(values, -1.), std::invalid_argument);
+}
+
+TEST_F(NumberTest, poisson_givenNonFiniteOrHugeMean_shouldThrowInvalidArgument)
+{
+    std::vector<std::uint64_t> values(10);
+
+    for (const auto mean : {std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN(), 0x1p63})
+    {
+        ASSERT_THROW(poisson(mean), std::invalid_argument);
+        ASSERT_THROW(poissons(values, mean), std::invalid_argument);
+    }
+}
+
+TEST_F(NumberTest, poisson_givenLargestMean_shouldGenerateValuesNearMean)
+{
+    std::vector<std::uint64_t> values(1000);
+
+    poissons(values, 0x1p62);
+
+    for (const auto value : values)
+    {
+        ASSERT_NEAR(static_cast<double>(value), 0x1p62, 0x1p40);
+    }
+}
+
+TEST_F(NumberTest, poissons_shouldMatchMeanAndVarianceForSmallAndLargeMeans)
+{
+    for (const auto expectedMean : {0.5, 3., 25., 1000.})
+    {
+        std::vector<std::uint64_t> counts(100000);
+
+        poissons(counts, expectedMean);
+
+        std::vector<double> values(counts.begin(), counts.end());
+
+        const auto [mean, variance] = meanAndVariance(values);
+
+        ASSERT_NEAR(mean, expectedMean, expectedMean * 0.02 + 0.01);
+        ASSERT_NEAR(variance, expectedMean, expectedMean * 0.05 + 0.02);
+    }
+
+    ASSERT_EQ(poisson(0.), 0u);
+}
+
+TEST_F(NumberTest, zipf_givenInvalidArguments_shouldThrowInvalidArgument)
+{
+    ASSERT_THROW(zipf(0, 1.), std::invalid_argument);
+    ASSERT_THROW(zipf(10, -0.5), std::invalid_argument);
+}
+
+TEST_F(NumberTest, zipfSampler_shouldMatchRankProbabilities)
+{
+    const ZipfSampler sampler{10, 1.};
+
+    std::vector<std::uint64_t> ranks(200000);
+
+    sampler(ranks);
+
+    std::vector<double> frequencies(11);
+
+    for (const auto rank : ranks)
+    {
+        ASSERT_GE(rank, 1u);
+        ASSERT_LE(rank, 10u);
+
+        frequencies[rank] += 1. / static_cast<double>(ranks.size());
+    }
+
+    double harmonicNumber = 0;
+
+    for (int rank = 1; rank <= 10; rank++)
+    {
+        harmonicNumber += 1. / rank;
+    }
+
+    for (int rank = 1; rank <= 10; rank++)
+    {
+        ASSERT_NEAR(frequencies[static_cast<std::size_t>(rank)], 1. / (rank * harmonicNumber), 0.005);
+    }
+}
+
+TEST_F(NumberTest, zipfSampler_givenZeroExponent_shouldGenerateUniformRanks)
+{
+    const ZipfSampler sampler{4, 0.};
+
+    std::vector<int> counts(5);
+
+    for (int i = 0; i < 40000; i++)
+    {
+        counts[sampler()]++;
+    }
+
+    ASSERT_EQ(counts[0], 0);
+
+    for (std::size_t rank = 1; rank <= 4; rank++)
+    {
+        ASSERT_NEAR(counts[rank], 10000, 500);
+    }
+}
+
+TEST_F(NumberTest, zipf_givenBillionsOfElements_shouldGenerateRankWithinRange)
+{
+    const std::uint64_t elementCount = 5000000000000;
+
+    for (const auto exponent : {0.5, 1., 1.5})
+    {
+        const auto rank = zipf(elementCount, exponent);
+
+        ASSERT_GE(rank, 1u);
+        ASSERT_LE(rank, elementCount);
+    }
+}
+
+TEST_F(NumberTest, permutation_givenSmallRange_shouldMapIndicesToDistinctValuesWithinRange)
+{
+    const Permutation permutation{5, 1004, 7};
+
+    std::vector<std::uint64_t> values;
+
+    for (std::uint64_t index = 0; index < 1000; index++)
+    {
+        values.push_back(permutation(index));
+
+        ASSERT_EQ(permutation.inverse(values.back()), index);
+    }
+
+    std::ranges::sort(values);
+
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        ASSERT_EQ(values[i], 5 + i);
+    }
+}
+
+TEST_F(NumberTest, permutation_givenHugeRange_shouldInvertValues)
+{
+    const Permutation permutation{0, 999'999'999'999, 42};
+
+    for (const std::uint64_t index : {std::uint64_t{0}, std::uint64_t{1}, std::uint64_t{123'456'789'012},
+                                      std::uint64_t{999'999'999'999}})
+    {
+        const auto value = permutation(index);
+
+        ASSERT_LE(value, 999'999'999'999u);
+        ASSERT_EQ(permutation.inverse(value), index);
+    }
+}
+
+TEST_F(NumberTest, permutation_givenFullRange_shouldInvertValues)
+{
+    const auto max = std::numeric_limits<std::uint64_t>::max();
+
+    const Permutation permutation{0, max, 3};
+
+    for (const std::uint64_t index : {std::uint64_t{0}, std::uint64_t{1}, max})
+    {
+        ASSERT_EQ(permutation.inverse(permutation(index)), index);
+    }
+}
+
+TEST_F(NumberTest, permutation_givenKeys_shouldSelectPermutation)
+{
+    const Permutation first{0, 1'000'000, 1};
+    const Permutation same{0, 1'000'000, 1};
+    const Permutation other{0, 1'000'000, 2};
+
+    int differences = 0;
+
+    for (std::uint64_t index = 0; index < 100; index++)
+    {
+        ASSERT_EQ(first(index), same(index));
+
+        differences += first(index) != other(index) ? 1 : 0;
+    }
+
+    ASSERT_GT(differences, 90);
+}
+
+TEST_F(NumberTest, permutation_givenSingleValueRange_shouldReturnIt)
+{
+    const Permutation permutation{17, 17};
+
+    ASSERT_EQ(permutation(0), 17u);
+    ASSERT_EQ(permutation.inverse(17), 0u);
+}
+
+TEST_F(NumberTest, permutation_givenInvalidArguments_shouldThrow)
+{
+    ASSERT_THROW((Permutation{10, 9, 0}), std::invalid_argument);
+
+    const Permutation permutation{10, 19, 0};
+
+    ASSERT_THROW(permutation(10), std::invalid_argument);
+    ASSERT_THROW(permutation.inverse(9), std::invalid_argument);
+    ASSERT_THROW(permutation.inverse(20), std::invalid_argument);
+}
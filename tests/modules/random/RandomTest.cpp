@@ -0,0 +1,635 @@
+#include "faker-cxx/Random.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "faker-cxx/Internet.h"
+#include "faker-cxx/Location.h"
+#include "faker-cxx/Number.h"
+#include "faker-cxx/Person.h"
+
+using namespace ::testing;
+using namespace faker;
+using namespace faker::random;
+
+class RandomTest : public Test
+{
+public:
+    static std::vector<std::uint64_t> fillWords(std::optional<InstructionSet> instructionSet)
+    {
+        if (instructionSet)
+        {
+            setInstructionSet(*instructionSet);
+            setSeed(31337);
+        }
+
+        std::vector<std::uint64_t> words(1003);
+
+        fill(std::span<std::uint64_t>{words.data(), 500});
+        fill(std::span<std::uint64_t>{words.data() + 500, 503});
+
+        return words;
+    }
+
+    static std::vector<std::string> generateRecord(std::uint64_t recordIndex)
+    {
+        RecordScope record{777, recordIndex};
+
+        return {person::fullName(), internet::email(), location::streetAddress(), std::to_string(integer(0, 1000))};
+    }
+
+    static int integer(int min, int max)
+    {
+        return number::integer<int>(min, max);
+    }
+
+    static std::vector<int> generateIntegers()
+    {
+        std::vector<int> integers;
+
+        for (int i = 0; i < 32; i++)
+        {
+            integers.push_back(number::integer<int>(0, 1000000));
+        }
+
+        return integers;
+    }
+};
+
+TEST_F(RandomTest, givenSameSeed_shouldGenerateSameSequence)
+{
+    setSeed(42);
+
+    const auto firstSequence = generateIntegers();
+    const auto firstName = std::string{person::firstName()};
+
+    setSeed(42);
+
+    const auto secondSequence = generateIntegers();
+    const auto secondName = std::string{person::firstName()};
+
+    ASSERT_EQ(firstSequence, secondSequence);
+    ASSERT_EQ(firstName, secondName);
+}
+
+TEST_F(RandomTest, givenDifferentSeeds_shouldGenerateDifferentSequences)
+{
+    setSeed(1);
+
+    const auto firstSequence = generateIntegers();
+
+    setSeed(2);
+
+    const auto secondSequence = generateIntegers();
+
+    ASSERT_NE(firstSequence, secondSequence);
+}
+
+TEST_F(RandomTest, givenThreadsWithSamePinnedStream_shouldGenerateSameSequence)
+{
+    setSeed(7);
+
+    std::vector<int> firstSequence;
+    std::vector<int> secondSequence;
+
+    std::thread firstWorker(
+        [&firstSequence]
+        {
+            setStream(5);
+            firstSequence = generateIntegers();
+        });
+    std::thread secondWorker(
+        [&secondSequence]
+        {
+            setStream(5);
+            secondSequence = generateIntegers();
+        });
+
+    firstWorker.join();
+    secondWorker.join();
+
+    ASSERT_EQ(firstSequence, secondSequence);
+}
+
+TEST_F(RandomTest, givenThreadsWithDifferentStreams_shouldGenerateDifferentSequences)
+{
+    setSeed(7);
+
+    std::vector<int> firstSequence;
+    std::vector<int> secondSequence;
+
+    std::thread firstWorker(
+        [&firstSequence]
+        {
+            setStream(1);
+            firstSequence = generateIntegers();
+        });
+    std::thread secondWorker(
+        [&secondSequence]
+        {
+            setStream(2);
+            secondSequence = generateIntegers();
+        });
+
+    firstWorker.join();
+    secondWorker.join();
+
+    ASSERT_NE(firstSequence, secondSequence);
+}
+
+TEST_F(RandomTest, enginesShouldSatisfyUniformRandomBitGenerator)
+{
+    static_assert(std::uniform_random_bit_generator<Xoshiro256StarStar>);
+    static_assert(std::uniform_random_bit_generator<Pcg64>);
+    static_assert(std::uniform_random_bit_generator<Wyrand>);
+    static_assert(std::uniform_random_bit_generator<Engine>);
+}
+
+TEST_F(RandomTest, givenSameSeed_enginesShouldGenerateSameSequence)
+{
+    for (const auto type : {EngineType::Xoshiro256StarStar, EngineType::Pcg64, EngineType::Wyrand})
+    {
+        Engine firstEngine{123, type};
+        Engine secondEngine{123, type};
+
+        for (int i = 0; i < 100; i++)
+        {
+            ASSERT_EQ(firstEngine(), secondEngine());
+        }
+    }
+}
+
+TEST_F(RandomTest, jumpShouldMoveEngineToDifferentStream)
+{
+    for (const auto type : {EngineType::Xoshiro256StarStar, EngineType::Pcg64, EngineType::Wyrand})
+    {
+        Engine engine{99, type};
+        Engine jumpedEngine{99, type};
+        Engine longJumpedEngine{99, type};
+
+        jumpedEngine.jump();
+        longJumpedEngine.longJump();
+
+        ASSERT_NE(engine, jumpedEngine);
+        ASSERT_NE(jumpedEngine, longJumpedEngine);
+        ASSERT_NE(engine(), jumpedEngine());
+        ASSERT_NE(jumpedEngine(), longJumpedEngine());
+    }
+}
+
+TEST_F(RandomTest, givenStreamZero_engineShouldMatchSeededEngine)
+{
+    for (const auto type :
+         {EngineType::Xoshiro256StarStar, EngineType::Pcg64, EngineType::Wyrand, EngineType::Philox4x32})
+    {
+        ASSERT_EQ((Engine{31, 0, type}), (Engine{31, type}));
+    }
+}
+
+TEST_F(RandomTest, givenStreamsTwoToTheSixteenApart_enginesShouldGenerateDifferentSequences)
+{
+    for (const auto type :
+         {EngineType::Xoshiro256StarStar, EngineType::Pcg64, EngineType::Wyrand, EngineType::Philox4x32})
+    {
+        Engine firstEngine{31, 0, type};
+        Engine secondEngine{31, 1 << 16, type};
+
+        ASSERT_NE(firstEngine, secondEngine);
+        ASSERT_NE(firstEngine(), secondEngine());
+    }
+}
+
+TEST_F(RandomTest, givenStreamsTwoToTheSixteenApart_threadsShouldGenerateDifferentSequences)
+{
+    const auto previousType = engineType();
+
+    for (const auto type :
+         {EngineType::Xoshiro256StarStar, EngineType::Pcg64, EngineType::Wyrand, EngineType::Philox4x32})
+    {
+        setEngineType(type);
+        setSeed(7);
+
+        std::vector<int> firstSequence;
+        std::vector<int> secondSequence;
+
+        std::thread firstWorker(
+            [&firstSequence]
+            {
+                setStream(0);
+                firstSequence = generateIntegers();
+            });
+        std::thread secondWorker(
+            [&secondSequence]
+            {
+                setStream(1 << 16);
+                secondSequence = generateIntegers();
+            });
+
+        firstWorker.join();
+        secondWorker.join();
+
+        ASSERT_NE(firstSequence, secondSequence);
+    }
+
+    setEngineType(previousType);
+}
+
+TEST_F(RandomTest, givenEngineType_shouldGenerateSameSequenceForSameSeed)
+{
+    const auto previousType = engineType();
+
+    for (const auto type : {EngineType::Xoshiro256StarStar, EngineType::Pcg64, EngineType::Wyrand})
+    {
+        setEngineType(type);
+
+        ASSERT_EQ(engineType(), type);
+        ASSERT_EQ(engine().type(), type);
+
+        setSeed(2024);
+
+        const auto firstSequence = generateIntegers();
+
+        setSeed(2024);
+
+        const auto secondSequence = generateIntegers();
+
+        ASSERT_EQ(firstSequence, secondSequence);
+    }
+
+    setEngineType(previousType);
+}
+
+TEST_F(RandomTest, fill_shouldGenerateSameWordsForEverySupportedInstructionSet)
+{
+    const auto previousInstructionSet = instructionSet();
+
+    const auto scalarWords = fillWords(InstructionSet::Scalar);
+
+    for (const auto set : {InstructionSet::Avx2, InstructionSet::Avx512})
+    {
+        if (isSupported(set))
+        {
+            ASSERT_EQ(fillWords(set), scalarWords);
+        }
+    }
+
+    setInstructionSet(previousInstructionSet);
+}
+
+TEST_F(RandomTest, fill_shouldContinueStreamAcrossCalls)
+{
+    setSeed(5);
+
+    std::vector<std::uint64_t> firstWords(64);
+    std::vector<std::uint64_t> secondWords(64);
+
+    fill(firstWords);
+    fill(secondWords);
+
+    ASSERT_NE(firstWords, secondWords);
+}
+
+TEST_F(RandomTest, fillBytes_givenSameSeed_shouldGenerateSameBytes)
+{
+    std::vector<std::uint8_t> firstBytes(77);
+    std::vector<std::uint8_t> secondBytes(77);
+
+    setSeed(11);
+    fillBytes(firstBytes);
+
+    setSeed(11);
+    fillBytes(secondBytes);
+
+    ASSERT_EQ(firstBytes, secondBytes);
+    ASSERT_TRUE(std::ranges::any_of(firstBytes, [](std::uint8_t byte) { return byte != 0; }));
+}
+
+TEST_F(RandomTest, scalarInstructionSetShouldAlwaysBeSupported)
+{
+    ASSERT_TRUE(isSupported(InstructionSet::Scalar));
+}
+
+TEST_F(RandomTest, philoxShouldMatchKnownAnswerVectors)
+{
+    ASSERT_EQ(Philox4x32::generateBlock({0, 0, 0, 0}, {0, 0}),
+              (Philox4x32::Counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    ASSERT_EQ(Philox4x32::generateBlock({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+              (Philox4x32::Counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    ASSERT_EQ(Philox4x32::generateBlock({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+              (Philox4x32::Counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST_F(RandomTest, philoxSeedWithStream_shouldNotDependOnPreviousSeeding)
+{
+    Philox4x32 reseeded{1, 9};
+
+    reseeded.seed(42, 3);
+    const auto firstDraw = reseeded();
+
+    reseeded.seed(42, 3);
+
+    ASSERT_EQ(reseeded(), firstDraw);
+    ASSERT_EQ(reseeded.stream(), std::uint64_t{3} << 32);
+
+    reseeded.seed(42);
+
+    ASSERT_EQ(reseeded, Philox4x32{42});
+}
+
+TEST_F(RandomTest, philoxConstructor_shouldMatchSeedWithStream)
+{
+    Philox4x32 constructed{42, 3};
+    Philox4x32 seeded;
+
+    seeded.seed(42, 3);
+
+    ASSERT_EQ(constructed, seeded);
+    ASSERT_EQ(constructed(), seeded());
+}
+
+TEST_F(RandomTest, philoxDiscardShouldSkipDraws)
+{
+    Philox4x32 sequential{42, 3};
+    Philox4x32 skipped{42, 3};
+
+    for (int i = 0; i < 1001; i++)
+    {
+        sequential();
+    }
+
+    skipped.discard(1001);
+
+    ASSERT_EQ(sequential(), skipped());
+    ASSERT_EQ(sequential(), skipped());
+}
+
+TEST_F(RandomTest, recordScope_shouldGenerateRecordIndependentlyOfPreviousRecords)
+{
+    std::vector<std::vector<std::string>> records;
+
+    for (std::uint64_t recordIndex = 0; recordIndex < 10; recordIndex++)
+    {
+        records.push_back(generateRecord(recordIndex));
+    }
+
+    setSeed(99);
+    number::integer<int>(0, 10);
+
+    ASSERT_EQ(generateRecord(7), records[7]);
+    ASSERT_EQ(generateRecord(3), records[3]);
+    ASSERT_NE(records[3], records[7]);
+}
+
+TEST_F(RandomTest, recordScope_shouldGenerateSameRecordInOtherThread)
+{
+    const auto record = generateRecord(12345678);
+
+    std::vector<std::string> recordFromWorker;
+
+    std::thread worker([&recordFromWorker] { recordFromWorker = generateRecord(12345678); });
+
+    worker.join();
+
+    ASSERT_EQ(record, recordFromWorker);
+}
+
+TEST_F(RandomTest, recordScope_shouldRestoreThreadEngine)
+{
+    setSeed(3);
+
+    const auto first = integer(0, 1000000);
+    const auto second = integer(0, 1000000);
+
+    setSeed(3);
+
+    ASSERT_EQ(integer(0, 1000000), first);
+
+    {
+        RecordScope record{1};
+
+        integer(0, 1000000);
+    }
+
+    ASSERT_EQ(integer(0, 1000000), second);
+}
+
+TEST_F(RandomTest, entropyPool_givenSameSeed_shouldGenerateSameBits)
+{
+    setSeed(21);
+
+    std::vector<std::uint64_t> firstValues;
+
+    for (unsigned count = 1; count <= 64; count++)
+    {
+        firstValues.push_back(entropyPool().bits(count));
+    }
+
+    setSeed(21);
+
+    for (unsigned count = 1; count <= 64; count++)
+    {
+        ASSERT_EQ(entropyPool().bits(count), firstValues[count - 1]);
+    }
+}
+
+TEST_F(RandomTest, entropyPool_bitsShouldFitInRequestedWidth)
+{
+    auto& pool = entropyPool();
+
+    for (unsigned count = 1; count < 64; count++)
+    {
+        ASSERT_LT(pool.bits(count), std::uint64_t{1} << count);
+    }
+}
+
+TEST_F(RandomTest, entropyPool_uniformShouldCoverWholeRange)
+{
+    auto& pool = entropyPool();
+
+    std::vector<int> counts(10);
+
+    for (int i = 0; i < 10000; i++)
+    {
+        const auto value = pool.uniform(10);
+
+        ASSERT_LT(value, 10u);
+
+        counts[value]++;
+    }
+
+    ASSERT_TRUE(std::ranges::all_of(counts, [](int count) { return count > 800 && count < 1200; }));
+    ASSERT_EQ(pool.uniform(1), 0u);
+}
+
+TEST_F(RandomTest, recordScope_shouldNotShareEntropyPoolWithThread)
+{
+    setSeed(8);
+
+    entropyPool().bits(3);
+
+    const auto expected = entropyPool().bits(16);
+
+    setSeed(8);
+
+    entropyPool().bits(3);
+
+    std::uint64_t firstRecordValue;
+    std::uint64_t secondRecordValue;
+
+    {
+        RecordScope record{8, 1};
+
+        firstRecordValue = entropyPool().bits(16);
+    }
+
+    ASSERT_EQ(entropyPool().bits(16), expected);
+
+    {
+        RecordScope record{8, 1};
+
+        secondRecordValue = entropyPool().bits(16);
+    }
+
+    ASSERT_EQ(firstRecordValue, secondRecordValue);
+}
+
+TEST_F(RandomTest, engineState_shouldRoundTripForEveryEngineType)
+{
+    for (const auto type : {EngineType::Xoshiro256StarStar, EngineType::Pcg64, EngineType::Wyrand})
+    {
+        Engine engine{17, type};
+
+        engine();
+
+        Engine restoredEngine;
+
+        restoredEngine.setState(engine.type(), engine.state());
+
+        ASSERT_EQ(restoredEngine, engine);
+        ASSERT_EQ(restoredEngine(), engine());
+    }
+
+    Engine philoxEngine{Philox4x32{17, 4}};
+
+    philoxEngine();
+
+    Engine restoredPhiloxEngine;
+
+    restoredPhiloxEngine.setState(philoxEngine.type(), philoxEngine.state());
+
+    ASSERT_EQ(restoredPhiloxEngine(), philoxEngine());
+    ASSERT_EQ(restoredPhiloxEngine(), philoxEngine());
+}
+
+TEST_F(RandomTest, restore_shouldRepeatDrawsAfterSnapshot)
+{
+    setSeed(404);
+
+    std::vector<std::uint64_t> skippedWords(5);
+
+    fill(skippedWords);
+    entropyPool().bits(5);
+
+    const auto checkpoint = snapshot();
+
+    const auto firstIntegers = generateIntegers();
+    const auto firstWords = fillWords(std::nullopt);
+    const auto firstBits = entropyPool().bits(20);
+    const auto firstName = person::fullName();
+
+    restore(checkpoint);
+
+    ASSERT_EQ(generateIntegers(), firstIntegers);
+    ASSERT_EQ(fillWords(std::nullopt), firstWords);
+    ASSERT_EQ(entropyPool().bits(20), firstBits);
+    ASSERT_EQ(person::fullName(), firstName);
+}
+
+TEST_F(RandomTest, restore_shouldApplySnapshotInOtherThread)
+{
+    setSeed(405);
+
+    const auto checkpoint = snapshot();
+    const auto integers = generateIntegers();
+
+    std::vector<int> integersFromWorker;
+
+    std::thread worker(
+        [&checkpoint, &integersFromWorker]
+        {
+            restore(checkpoint);
+            integersFromWorker = generateIntegers();
+        });
+
+    worker.join();
+
+    ASSERT_EQ(integersFromWorker, integers);
+}
+
+TEST_F(RandomTest, snapshot_shouldRoundTripThroughSerialization)
+{
+    const auto previousType = engineType();
+
+    for (const auto type : {EngineType::Xoshiro256StarStar, EngineType::Pcg64, EngineType::Wyrand})
+    {
+        setEngineType(type);
+        setSeed(406);
+
+        entropyPool().bits(7);
+
+        const auto checkpoint = snapshot();
+        const auto bytes = checkpoint.serialize();
+        const auto decoded = Snapshot::deserialize(bytes);
+
+        ASSERT_EQ(decoded, checkpoint);
+
+        const auto integers = generateIntegers();
+
+        restore(decoded);
+
+        ASSERT_EQ(generateIntegers(), integers);
+    }
+
+    setEngineType(previousType);
+
+    std::vector<std::uint64_t> words(3);
+
+    fill(words);
+
+    const auto checkpointWithLanes = snapshot();
+
+    ASSERT_EQ(Snapshot::deserialize(checkpointWithLanes.serialize()), checkpointWithLanes);
+    ASSERT_LE(checkpointWithLanes.serialize().size(), 300u);
+
+    RecordScope record{9};
+
+    const auto recordCheckpoint = snapshot();
+
+    ASSERT_EQ(Snapshot::deserialize(recordCheckpoint.serialize()), recordCheckpoint);
+}
+
+TEST_F(RandomTest, deserialize_givenInvalidBytes_shouldThrowInvalidArgument)
+{
+    auto bytes = snapshot().serialize();
+
+    ASSERT_THROW(Snapshot::deserialize({}), std::invalid_argument);
+    ASSERT_THROW(Snapshot::deserialize(std::span<const std::uint8_t>{bytes.data(), bytes.size() - 1}),
+                 std::invalid_argument);
+
+    bytes.push_back(0);
+
+    ASSERT_THROW(Snapshot::deserialize(bytes), std::invalid_argument);
+
+    bytes.pop_back();
+    bytes[0] = 99;
+
+    ASSERT_THROW(Snapshot::deserialize(bytes), std::invalid_argument);
+}
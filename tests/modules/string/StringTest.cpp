@@ -1,14 +1,19 @@
 #include "faker-cxx/String.h"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <iterator>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 
+#include "faker-cxx/Random.h"
 #include "faker-cxx/RandomGenerator.h"
 #include "faker-cxx/types/Hex.h"
 #include "string/StringData.h"
@@ -488,12 +493,7 @@ TEST_F(StringTest, shouldGenerateLowerAlphaWithGuarantee)
 
         ASSERT_EQ(generatedAlpha.size(), alphaLength);
         ASSERT_TRUE(std::ranges::all_of(generatedAlpha,
-                                        [](char alphaCharacter)
-                                        {
-                                            return std::ranges::any_of(lowerCharSet,
-                                                                       [alphaCharacter](char lowerCharacter)
-                                                                       { return lowerCharacter == alphaCharacter; });
-                                        }));
+                                        [](char alphaCharacter) { return lowerCharSet.contains(alphaCharacter); }));
         auto count_k = std::ranges::count(generatedAlpha, 'k');
         auto count_o = std::ranges::count(generatedAlpha, 'o');
         auto count_a = std::ranges::count(generatedAlpha, 'a');
@@ -521,12 +521,7 @@ TEST_F(StringTest, shouldGenerateUpperAlphaWithGuarantee)
 
         ASSERT_EQ(generatedAlpha.size(), alphaLength);
         ASSERT_TRUE(std::ranges::all_of(generatedAlpha,
-                                        [](char alphaCharacter)
-                                        {
-                                            return std::ranges::any_of(upperCharSet,
-                                                                       [alphaCharacter](char lowerCharacter)
-                                                                       { return lowerCharacter == alphaCharacter; });
-                                        }));
+                                        [](char alphaCharacter) { return upperCharSet.contains(alphaCharacter); }));
         auto count_K = std::ranges::count(generatedAlpha, 'K');
         auto count_O = std::ranges::count(generatedAlpha, 'O');
         auto count_A = std::ranges::count(generatedAlpha, 'A');
@@ -1198,7 +1193,7 @@ TEST_F(StringTest, shouldGenerateBinary)
 
     ASSERT_EQ(generatedBinary.size(), binaryLength + 2);
     ASSERT_EQ(prefix, "0b");
-    ASSERT_TRUE(std::ranges::any_of(generatedBinary, [](char binaryNumberCharacter)
+    ASSERT_TRUE(std::ranges::all_of(binaryNumber, [](char binaryNumberCharacter)
                                     { return std::string("01").find(binaryNumberCharacter) != std::string::npos; }));
 }
 
@@ -1347,7 +1342,7 @@ TEST_F(StringTest, shouldGenerateOctalWithPrefix)
     ASSERT_EQ(generatedOctal.size(), octalLength + 2);
     ASSERT_EQ(prefix, "0o");
     ASSERT_TRUE(
-        std::ranges::any_of(generatedOctal, [](char octalNumberCharacter)
+        std::ranges::all_of(octalNumber, [](char octalNumberCharacter)
                             { return std::string("01234567").find(octalNumberCharacter) != std::string::npos; }));
 }
 
@@ -1452,3 +1447,164 @@ TEST_F(StringTest, invalidGuaranteeForOctal3)
     GuaranteeMap guarantee{{'0', {0, 2}}, {'1', {0, 2}}, {'8', {2, 3}}, {'2', {0, 2}}, {'3', {0, 2}}};
     ASSERT_THROW(octal(std::move(guarantee), octalLength), std::invalid_argument);
 }
+
+TEST_F(StringTest, shouldAppendSameCharactersAsValueOverloads)
+{
+    std::string expectedAlpha;
+    std::string expectedHexadecimal;
+
+    {
+        random::RecordScope scope{42, 0};
+
+        expectedAlpha = alpha(20, StringCasing::Upper, "AEIOU");
+        expectedHexadecimal = hexadecimal(12, HexCasing::Upper, HexPrefix::Hash);
+    }
+
+    random::RecordScope scope{42, 0};
+
+    std::string generated{"DE"};
+
+    alpha(generated, 20, StringCasing::Upper, "AEIOU");
+    hexadecimal(generated, 12, HexCasing::Upper, HexPrefix::Hash);
+
+    ASSERT_EQ(generated, "DE" + expectedAlpha + expectedHexadecimal);
+}
+
+TEST_F(StringTest, shouldKeepStringWhenAppendThrows)
+{
+    std::string generated{"prefix"};
+
+    ASSERT_THROW(fromCharacters(generated, "", 5), std::invalid_argument);
+    ASSERT_EQ(generated, "prefix");
+}
+
+TEST_F(StringTest, shouldFillSpans)
+{
+    std::array<char, 64> buffer;
+
+    for (int i = 0; i < runCount; i++)
+    {
+        numeric(buffer, false);
+
+        ASSERT_NE(buffer[0], '0');
+        ASSERT_TRUE(std::ranges::all_of(buffer, [](char digit) { return digit >= '0' && digit <= '9'; }));
+
+        binary(buffer);
+
+        ASSERT_TRUE(std::ranges::all_of(buffer, [](char digit) { return digit == '0' || digit == '1'; }));
+
+        octal(buffer);
+
+        ASSERT_TRUE(std::ranges::all_of(buffer, [](char digit) { return digit >= '0' && digit <= '7'; }));
+
+        alphanumeric(std::span<char>{buffer}.first(10), StringCasing::Lower);
+
+        ASSERT_TRUE(std::ranges::all_of(std::span<char>{buffer}.first(10), [](char character)
+                                        { return std::islower(character) || std::isdigit(character); }));
+    }
+}
+
+TEST_F(StringTest, shouldWriteThroughOutputIterator)
+{
+    const unsigned length = 1000;
+
+    std::string expected;
+
+    {
+        random::RecordScope scope{7, 0};
+
+        expected = alphanumeric(length);
+    }
+
+    random::RecordScope scope{7, 0};
+
+    std::vector<char> generated;
+
+    auto end = alphanumeric(std::back_inserter(generated), length);
+
+    *end = '!';
+
+    ASSERT_EQ(std::string(generated.begin(), generated.end()), expected + '!');
+}
+
+TEST_F(StringTest, shouldWriteNumericWithoutLeadingZerosThroughOutputIterator)
+{
+    for (int i = 0; i < runCount; i++)
+    {
+        std::string generated;
+
+        numeric(std::back_inserter(generated), 600, false);
+
+        ASSERT_EQ(generated.size(), 600);
+        ASSERT_NE(generated[0], '0');
+        ASSERT_TRUE(std::ranges::all_of(generated, [](char digit) { return digit >= '0' && digit <= '9'; }));
+    }
+}
+
+TEST_F(StringTest, shouldWritePrefixThroughOutputIterator)
+{
+    std::string generated;
+
+    binary(octal(hexadecimal(std::back_inserter(generated), 4), 3), 2);
+
+    ASSERT_EQ(generated.size(), 15);
+    ASSERT_EQ(generated.substr(0, 2), "0x");
+    ASSERT_EQ(generated.substr(6, 2), "0o");
+    ASSERT_EQ(generated.substr(11, 2), "0b");
+}
+
+TEST_F(StringTest, shouldGenerateSameCharactersForEveryInstructionSet)
+{
+    const auto generate = []
+    {
+        random::RecordScope scope{2024, 0};
+
+        std::string wideCharacters;
+
+        // 65536 % 211 draws are rejected, so the kernels also map blocks with rejected draws.
+        for (int character = 0; character < 211; character++)
+        {
+            wideCharacters += static_cast<char>('A' + character % 26);
+        }
+
+        return alpha(1001) + alphanumeric(517, StringCasing::Lower) + hexadecimal(333) + binary(99) + octal(77) +
+               fromCharacters(wideCharacters, 3000) + sample(203);
+    };
+
+    const auto previousInstructionSet = random::instructionSet();
+
+    random::setInstructionSet(random::InstructionSet::Scalar);
+
+    const auto scalarCharacters = generate();
+
+    for (const auto set : {random::InstructionSet::Avx2, random::InstructionSet::Avx512})
+    {
+        if (random::isSupported(set))
+        {
+            random::setInstructionSet(set);
+
+            ASSERT_EQ(generate(), scalarCharacters);
+        }
+    }
+
+    random::setInstructionSet(previousInstructionSet);
+}
+
+TEST_F(StringTest, shouldDrawCharactersUniformly)
+{
+    const unsigned length = 60000;
+
+    for (const std::string characters : {"abc", "0123"})
+    {
+        const auto generated = fromCharacters(characters, length);
+
+        const auto expectedCount = static_cast<double>(length) / static_cast<double>(characters.size());
+
+        for (const auto character : characters)
+        {
+            const auto count = static_cast<double>(std::ranges::count(generated, character));
+
+            ASSERT_NEAR(count, expectedCount, expectedCount * 0.05);
+        }
+    }
+}
@@ -5,6 +5,7 @@
 #include <regex>
 #include <set>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -53,6 +54,39 @@ TEST_F(SystemTest, FileNameTestWithExtensionCount)
     EXPECT_FALSE(expectedFileName2.empty());
 }
 
+TEST_F(SystemTest, FileNameHasDistinctExtensions)
+{
+    std::set<std::string_view> knownExtensions;
+
+    for (const auto& mimeType : mimeTypes)
+    {
+        const auto it = mimeTypesExtensions.find(mimeType);
+
+        knownExtensions.insert(it != mimeTypesExtensions.end() ? it->second
+                                                               : mimeType.substr(mimeType.find_last_of('/') + 1));
+    }
+
+    std::size_t expectedSuffixLength = 0;
+
+    for (const auto& extension : knownExtensions)
+    {
+        expectedSuffixLength += extension.size() + 1;
+    }
+
+    FileOptions options;
+    options.extensionCount = static_cast<int>(knownExtensions.size()) + 10;
+
+    const auto generatedFileName = fileName(options);
+    const auto suffix = generatedFileName.substr(generatedFileName.find('.'));
+
+    ASSERT_EQ(suffix.size(), expectedSuffixLength);
+
+    for (const auto& extension : knownExtensions)
+    {
+        ASSERT_NE(suffix.find("." + std::string{extension}), std::string::npos);
+    }
+}
+
 TEST_F(SystemTest, FileExtTestWithMimeType)
 {
     const auto exampleFileExtension = fileExtension();
@@ -1,6 +1,8 @@
 #include "faker-cxx/Word.h"
 
 #include <algorithm>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -210,6 +212,32 @@ TEST_F(WordTest, shouldGenerateSampleWithNonExistingLength)
                                     { return word == generatedSample; }));
 }
 
+TEST_F(WordTest, shouldGenerateSampleWithSkew)
+{
+    const auto generatedSample = sample(std::nullopt, 1.1);
+    const auto generatedSampleWithLength = sample(5, 1.1);
+
+    ASSERT_TRUE(std::ranges::any_of(_allWords, [generatedSample](const std::string_view& word)
+                                    { return word == generatedSample; }));
+    ASSERT_EQ(generatedSampleWithLength.size(), 5);
+    ASSERT_THROW(sample(5, -1.), std::invalid_argument);
+}
+
+TEST_F(WordTest, shouldGenerateMostCommonWordMostOftenWithSkew)
+{
+    int theCount = 0;
+    int aboutCount = 0;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        theCount += sample(std::nullopt, 2.) == "the" ? 1 : 0;
+        aboutCount += sample(5, 2.) == "about" ? 1 : 0;
+    }
+
+    ASSERT_GT(theCount, 450);
+    ASSERT_GT(aboutCount, 450);
+}
+
 TEST_F(WordTest, shouldGenerateWords)
 {
     const auto generatedWords = words(5);